@@ -32,6 +32,13 @@ class CatmullRomSpline : public CatmullRomSplineInterface
 public:
   CatmullRomSpline() = default;
   explicit CatmullRomSpline(const std::vector<geometry_msgs::msg::Point> & control_points);
+  /**
+   * @brief Same as CatmullRomSpline(control_points), but reuses the curves of previous which are
+   * built from the same control points, e.g. when a route is shifted by a lanelet.
+   */
+  explicit CatmullRomSpline(
+    const std::vector<geometry_msgs::msg::Point> & control_points,
+    const CatmullRomSpline & previous);
   double getLength() const override { return total_length_; }
   double getMaximum2DCurvature() const;
   const geometry_msgs::msg::Point getPoint(double s) const;
@@ -20,6 +20,7 @@
 #include <rclcpp/rclcpp.hpp>
 #include <scenario_simulator_exception/exception.hpp>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -27,6 +28,33 @@ namespace math
 {
 namespace geometry
 {
+namespace
+{
+/**
+ * @note Returns the index of the first control point of current in previous and the number of
+ * control points shared by both from there, or (0, 0) if there is no such control point.
+ */
+auto findSharedControlPoints(
+  const std::vector<geometry_msgs::msg::Point> & previous,
+  const std::vector<geometry_msgs::msg::Point> & current) -> std::pair<size_t, size_t>
+{
+  const auto same = [](const auto & p0, const auto & p1) {
+    return p0.x == p1.x and p0.y == p1.y and p0.z == p1.z;
+  };
+  for (size_t offset = 0; not current.empty() and offset < previous.size(); offset++) {
+    if (same(previous[offset], current[0])) {
+      size_t size = 1;
+      while (offset + size < previous.size() and size < current.size() and
+             same(previous[offset + size], current[size])) {
+        size++;
+      }
+      return std::make_pair(offset, size);
+    }
+  }
+  return std::make_pair(0, 0);
+}
+}  // namespace
+
 const std::vector<geometry_msgs::msg::Point> CatmullRomSpline::getPolygon(
   double width, size_t num_points, double z_offset)
 {
@@ -130,6 +158,12 @@ const std::vector<geometry_msgs::msg::Point> CatmullRomSpline::getTrajectory(
 }
 
 CatmullRomSpline::CatmullRomSpline(const std::vector<geometry_msgs::msg::Point> & control_points)
+: CatmullRomSpline(control_points, CatmullRomSpline())
+{
+}
+
+CatmullRomSpline::CatmullRomSpline(
+  const std::vector<geometry_msgs::msg::Point> & control_points, const CatmullRomSpline & previous)
 : control_points(control_points)
 {
   size_t n = control_points.size() - 1;
@@ -138,8 +172,18 @@ CatmullRomSpline::CatmullRomSpline(const std::vector<geometry_msgs::msg::Point>
       control_points.size(),
       " control points are only exists. At minimum, 3 control points are required");
   }
+  /**
+   * @note An inner curve depends only on the 4 control points around it, so it is the same as the
+   * curve of previous built from the same 4 control points. The first and the last curves are
+   * always rebuilt, since they are built from 3 control points in a different way.
+   */
+  size_t offset, shared_size;
+  std::tie(offset, shared_size) = findSharedControlPoints(previous.control_points, control_points);
+  const auto reusable = [&](size_t i) { return 0 < i and i + 1 < n and i + 2 < shared_size; };
   for (size_t i = 0; i < n; i++) {
-    if (i == 0) {
+    if (reusable(i)) {
+      curves_.emplace_back(previous.curves_[offset + i]);
+    } else if (i == 0) {
       double ax = 0;
       double bx = control_points[0].x - 2 * control_points[1].x + control_points[2].x;
       double cx = -3 * control_points[0].x + 4 * control_points[1].x - control_points[2].x;
@@ -225,9 +269,14 @@ CatmullRomSpline::CatmullRomSpline(const std::vector<geometry_msgs::msg::Point>
       curves_.emplace_back(HermiteCurve(ax, bx, cx, dx, ay, by, cy, dy, az, bz, cz, dz));
     }
   }
-  for (const auto & curve : curves_) {
-    length_list_.emplace_back(curve.getLength());
-    maximum_2d_curvatures_.emplace_back(curve.getMaximum2DCurvature());
+  for (size_t i = 0; i < n; i++) {
+    if (reusable(i)) {
+      length_list_.emplace_back(previous.length_list_[offset + i]);
+      maximum_2d_curvatures_.emplace_back(previous.maximum_2d_curvatures_[offset + i]);
+    } else {
+      length_list_.emplace_back(curves_[i].getLength());
+      maximum_2d_curvatures_.emplace_back(curves_[i].getMaximum2DCurvature());
+    }
   }
   total_length_ = 0;
   for (const auto & length : length_list_) {
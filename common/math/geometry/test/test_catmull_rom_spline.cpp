@@ -14,8 +14,11 @@
 
 #include <gtest/gtest.h>
 
+#include <cmath>
 #include <geometry/spline/catmull_rom_spline.hpp>
 #include <scenario_simulator_exception/exception.hpp>
+#include <utility>
+#include <vector>
 
 #include "expect_eq_macros.hpp"
 
@@ -240,6 +243,32 @@ TEST(CatmullRomSpline, CheckThrowingErrorWhenTheControlPointsAreNotEnough)
     common::SemanticError);
 }
 
+TEST(CatmullRomSpline, ReuseCurvesOfPreviousSpline)
+{
+  std::vector<geometry_msgs::msg::Point> points;
+  for (int i = 0; i < 30; i++) {
+    geometry_msgs::msg::Point p;
+    p.x = i * 2.0;
+    p.y = std::sin(i * 0.3) * 5.0;
+    p.z = i * 0.1;
+    points.emplace_back(p);
+  }
+  const auto slice = [&](std::size_t first, std::size_t last) {
+    return std::vector<geometry_msgs::msg::Point>(points.begin() + first, points.begin() + last);
+  };
+  const auto previous = math::geometry::CatmullRomSpline(slice(0, 20));
+  for (const auto & [first, last] : std::vector<std::pair<std::size_t, std::size_t>>{
+         {0, 20}, {5, 30}, {5, 15}, {0, 25}, {18, 30}, {19, 30}, {20, 30}}) {
+    const auto expected = math::geometry::CatmullRomSpline(slice(first, last));
+    const auto actual = math::geometry::CatmullRomSpline(slice(first, last), previous);
+    EXPECT_EQ(actual.getLength(), expected.getLength());
+    EXPECT_EQ(actual.getMaximum2DCurvature(), expected.getMaximum2DCurvature());
+    for (double s = -1.0; s < expected.getLength() + 1.0; s += 0.7) {
+      EXPECT_POINT_EQ(actual.getPoint(s), expected.getPoint(s));
+    }
+  }
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,80 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <cpp_mock_scenarios/catalogs.hpp>
+#include <cpp_mock_scenarios/cpp_scenario_node.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <traffic_simulator/api/api.hpp>
+#include <traffic_simulator_msgs/msg/behavior_parameter.hpp>
+
+// headers in STL
+#include <memory>
+#include <string>
+#include <vector>
+
+/// @note Test case to verify if the intelligent_driver_model plugin can follow a slower vehicle.
+class LoadIntelligentDriverModelPlugin : public cpp_mock_scenarios::CppScenarioNode
+{
+public:
+  explicit LoadIntelligentDriverModelPlugin(const rclcpp::NodeOptions & option)
+  : cpp_mock_scenarios::CppScenarioNode(
+      "load_intelligent_driver_model_plugin",
+      ament_index_cpp::get_package_share_directory("kashiwanoha_map") + "/map",
+      "private_road_and_walkway_ele_fix/lanelet2_map.osm", __FILE__, false, option)
+  {
+    start();
+  }
+
+private:
+  void onUpdate() override
+  {
+    // LCOV_EXCL_START
+    if (const auto action = api_.getCurrentAction("npc");
+        action != "follow_lane" && action != "lane_change") {
+      stop(cpp_mock_scenarios::Result::FAILURE);
+    }
+    if (api_.checkCollision("front", "npc")) {
+      stop(cpp_mock_scenarios::Result::FAILURE);
+    }
+    // LCOV_EXCL_STOP
+    if (api_.getCurrentTime() >= 10) {
+      stop(cpp_mock_scenarios::Result::SUCCESS);
+    }
+  }
+  void onInitialize() override
+  {
+    api_.spawn(
+      "front", api_.canonicalize(traffic_simulator::helper::constructLaneletPose(34741, 30, 0)),
+      getVehicleParameters());
+    api_.setLinearVelocity("front", 3);
+    api_.requestSpeedChange("front", 3, true);
+
+    api_.spawn(
+      "npc", api_.canonicalize(traffic_simulator::helper::constructLaneletPose(34741, 0, 0)),
+      getVehicleParameters(),
+      traffic_simulator::entity::VehicleEntity::BuiltinBehavior::intelligentDriverModel());
+    api_.setLinearVelocity("npc", 10);
+  }
+};
+
+int main(int argc, char * argv[])
+{
+  rclcpp::init(argc, argv);
+  rclcpp::NodeOptions options;
+  auto component = std::make_shared<LoadIntelligentDriverModelPlugin>(options);
+  rclcpp::spin(component);
+  rclcpp::shutdown();
+  return 0;
+}
@@ -17,6 +17,7 @@
 
 #include <boost/variant.hpp>
 #include <chrono>
+#include <cstdint>
 #include <lifecycle_msgs/msg/state.hpp>
 #include <lifecycle_msgs/msg/transition.hpp>
 #include <memory>
@@ -60,6 +61,8 @@ class Interpreter : public rclcpp_lifecycle::LifecycleNode,
 
   String output_directory;
 
+  std::int64_t publish_decimation;
+
   bool record;
 
   std::shared_ptr<OpenScenario> script;
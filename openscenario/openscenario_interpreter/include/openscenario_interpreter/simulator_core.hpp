@@ -15,6 +15,7 @@
 #ifndef OPENSCENARIO_INTERPRETER__SIMULATOR_CORE_HPP_
 #define OPENSCENARIO_INTERPRETER__SIMULATOR_CORE_HPP_
 
+#include <algorithm>
 #include <geometry_msgs/msg/point.hpp>
 #include <geometry_msgs/msg/pose.hpp>
 #include <limits>
@@ -22,6 +23,7 @@
 #include <openscenario_interpreter/error.hpp>
 #include <openscenario_interpreter/syntax/boolean.hpp>
 #include <openscenario_interpreter/syntax/double.hpp>
+#include <openscenario_interpreter/syntax/object_type.hpp>
 #include <openscenario_interpreter/syntax/string.hpp>
 #include <openscenario_interpreter/syntax/unsigned_integer.hpp>
 #include <openscenario_interpreter/type_traits/requires.hpp>
@@ -202,6 +204,12 @@ public:
       return core->spawn(std::forward<decltype(xs)>(xs)...);
     }
 
+    template <typename... Ts>
+    static auto getEntityHandle(Ts &&... xs)
+    {
+      return core->getEntityHandle(std::forward<decltype(xs)>(xs)...);
+    }
+
     template <typename EntityRef, typename DynamicConstraints>
     static auto applyProfileAction(
       const EntityRef & entity_ref, const DynamicConstraints & dynamic_constraints) -> void
@@ -248,6 +256,8 @@ public:
       core->setBehaviorParameter(entity_ref, [&]() {
         auto message = core->getBehaviorParameter(entity_ref);
         message.see_around = not controller.properties.template get<Boolean>("isBlind");
+        /// @note Only pedestrians walking straight avoid other entities, by the social force model.
+        message.avoid_entities = controller.properties.template get<Boolean>("avoidEntities");
         return message;
       }());
 
@@ -358,6 +368,16 @@ public:
       return core->checkCollision(std::forward<decltype(xs)>(xs)...);
     }
 
+    static auto evaluateCollisionConditionByType(
+      const std::string & entity_ref, const ObjectType & object_type) -> bool
+    {
+      const auto colliding_entities = core->getCollidingEntities(entity_ref);
+      return std::any_of(
+        colliding_entities.begin(), colliding_entities.end(), [&](const auto & name) {
+          return object_type.matches(core->getEntityType(name));
+        });
+    }
+
     template <typename... Ts>
     static auto evaluateFreespaceEuclideanDistance(Ts &&... xs)  // for RelativeDistanceCondition
     {
@@ -15,7 +15,9 @@
 #ifndef OPENSCENARIO_INTERPRETER__SYNTAX__BY_TYPE_HPP_
 #define OPENSCENARIO_INTERPRETER__SYNTAX__BY_TYPE_HPP_
 
+#include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/object_type.hpp>
+#include <pugixml.hpp>
 
 namespace openscenario_interpreter
 {
@@ -30,7 +32,12 @@ inline namespace syntax
  * -------------------------------------------------------------------------- */
 struct ByType
 {
+  const ObjectType type;
+
+  explicit ByType(const pugi::xml_node &, Scope &);
 };
+
+auto operator<<(std::ostream &, const ByType &) -> std::ostream &;
 }  // namespace syntax
 }  // namespace openscenario_interpreter
 
@@ -17,7 +17,9 @@
 
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/entity_ref.hpp>
+#include <optional>
 #include <pugixml.hpp>
+#include <traffic_simulator/entity/entity_handle.hpp>
 
 namespace openscenario_interpreter
 {
@@ -39,6 +41,9 @@ struct Entities : public std::unordered_map<std::string, Object>  // TODO to be
 
   auto isAdded(const EntityRef &) const -> bool;
 
+  /// @note Handle of the added entity, or std::nullopt if AddEntityAction is not applied yet.
+  auto handle(const EntityRef &) const -> std::optional<traffic_simulator::entity::EntityHandle>;
+
   auto ref(const EntityRef &) const -> Object;
 };
 }  // namespace syntax
@@ -15,6 +15,9 @@
 #ifndef OPENSCENARIO_INTERPRETER__SYNTAX__OBJECT_TYPE_HPP_
 #define OPENSCENARIO_INTERPRETER__SYNTAX__OBJECT_TYPE_HPP_
 
+#include <iostream>
+#include <traffic_simulator_msgs/msg/entity_type.hpp>
+
 namespace openscenario_interpreter
 {
 inline namespace syntax
@@ -39,7 +42,37 @@ inline namespace syntax
  * -------------------------------------------------------------------------- */
 struct ObjectType
 {
+  enum value_type {
+    // NOTE: Sorted by lexicographic order.
+    miscellaneous,
+    pedestrian,
+    vehicle,
+  } value;
+
+  explicit constexpr ObjectType(value_type value = vehicle) : value(value) {}
+
+  constexpr operator value_type() const noexcept { return value; }
+
+  /// @note The ego entity is a vehicle too.
+  auto matches(const traffic_simulator_msgs::msg::EntityType & entity_type) const noexcept -> bool
+  {
+    switch (value) {
+      case miscellaneous:
+        return entity_type.type == traffic_simulator_msgs::msg::EntityType::MISC_OBJECT;
+      case pedestrian:
+        return entity_type.type == traffic_simulator_msgs::msg::EntityType::PEDESTRIAN;
+      case vehicle:
+        return entity_type.type == traffic_simulator_msgs::msg::EntityType::EGO or
+               entity_type.type == traffic_simulator_msgs::msg::EntityType::VEHICLE;
+      default:
+        return false;
+    }
+  }
 };
+
+auto operator>>(std::istream &, ObjectType &) -> std::istream &;
+
+auto operator<<(std::ostream &, const ObjectType &) -> std::ostream &;
 }  // namespace syntax
 }  // namespace openscenario_interpreter
 
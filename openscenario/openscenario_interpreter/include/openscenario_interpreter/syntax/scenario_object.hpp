@@ -20,7 +20,9 @@
 #include <openscenario_interpreter/syntax/entity_object.hpp>
 #include <openscenario_interpreter/syntax/object_controller.hpp>
 #include <openscenario_interpreter/syntax/string.hpp>
+#include <optional>
 #include <pugixml.hpp>
+#include <traffic_simulator/entity/entity_handle.hpp>
 
 namespace openscenario_interpreter
 {
@@ -43,6 +45,9 @@ struct ScenarioObject : public Scope, public EntityObject
 
   bool is_added = false;  // NOTE: Is applied AddEntityAction?
 
+  // NOTE: Handle of the entity spawned by AddEntityAction, used by conditions evaluated every frame.
+  std::optional<traffic_simulator::entity::EntityHandle> handle = std::nullopt;
+
   explicit ScenarioObject(const pugi::xml_node &, Scope &);
 };
 }  // namespace syntax
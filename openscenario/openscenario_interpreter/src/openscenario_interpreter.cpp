@@ -38,12 +38,14 @@ Interpreter::Interpreter(const rclcpp::NodeOptions & options)
   local_real_time_factor(1.0),
   osc_path(""),
   output_directory("/tmp"),
+  publish_decimation(1),
   record(false)
 {
   DECLARE_PARAMETER(local_frame_rate);
   DECLARE_PARAMETER(local_real_time_factor);
   DECLARE_PARAMETER(osc_path);
   DECLARE_PARAMETER(output_directory);
+  DECLARE_PARAMETER(publish_decimation);
   DECLARE_PARAMETER(record);
 }
 
@@ -67,6 +69,7 @@ auto Interpreter::makeCurrentConfiguration() const -> traffic_simulator::Configu
     logic_file.isDirectory() ? logic_file : logic_file.filepath.parent_path());
   {
     configuration.auto_sink = false;
+    configuration.publish_decimation = std::max<std::int64_t>(publish_decimation, 1);
     configuration.scenario_path = osc_path;
 
     // XXX DIRTY HACK!!!
@@ -102,6 +105,7 @@ auto Interpreter::on_configure(const rclcpp_lifecycle::State &) -> Result
       GET_PARAMETER(local_real_time_factor);
       GET_PARAMETER(osc_path);
       GET_PARAMETER(output_directory);
+      GET_PARAMETER(publish_decimation);
       GET_PARAMETER(record);
 
       script = std::make_shared<OpenScenario>(osc_path);
@@ -158,6 +158,7 @@ try {
 
   if (not std::exchange(entity.as<ScenarioObject>().is_added, true)) {
     apply<void>(add_entity, entity.as<EntityObject>());
+    entity.as<ScenarioObject>().handle = getEntityHandle(entity_ref);
   } else {
     throw SemanticError(
       "Applying action AddEntityAction to an entity ", std::quoted(entity_ref),
@@ -14,6 +14,7 @@
 
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/simulator_core.hpp>
+#include <openscenario_interpreter/syntax/by_type.hpp>
 #include <openscenario_interpreter/syntax/collision_condition.hpp>
 #include <openscenario_interpreter/syntax/entities.hpp>
 #include <openscenario_interpreter/syntax/entity_ref.hpp>
@@ -29,7 +30,7 @@ CollisionCondition::CollisionCondition(
   another_given_entity(
     choice(node,
       std::make_pair("EntityRef", [&](auto && node) { return make<EntityRef>(node, scope); }),
-      std::make_pair("ByType",    [&](auto && node) { throw UNSUPPORTED_ELEMENT_SPECIFIED(node.name()); return unspecified; }))),
+      std::make_pair("ByType",    [&](auto && node) { return make<ByType>(node, scope); }))),
   triggering_entities(triggering_entities)
 // clang-format on
 {
@@ -39,11 +40,13 @@ auto CollisionCondition::description() const -> std::string
 {
   std::stringstream description;
 
-  description << triggering_entities.description() << " colliding with another given entity "
-              << another_given_entity << "?";
-
-  // TODO (yamacir-kit): If another_given_entity.is<ByType>(), description
-  // will be "Is any of [A, B, C] colliding with another T typed entities?"
+  if (another_given_entity.is<ByType>()) {
+    description << triggering_entities.description() << " colliding with another "
+                << another_given_entity.as<ByType>().type << " typed entities?";
+  } else {
+    description << triggering_entities.description() << " colliding with another given entity "
+                << another_given_entity << "?";
+  }
 
   return description.str();
 }
@@ -53,11 +56,22 @@ auto CollisionCondition::evaluate() const -> Object
   if (
     another_given_entity.is<EntityRef>() and
     global().entities->isAdded(another_given_entity.as<EntityRef>())) {
+    /// @note Handles are resolved by the simulator without looking up the entity names.
+    const auto another_handle = global().entities->handle(another_given_entity.as<EntityRef>());
+    return asBoolean(triggering_entities.apply([&](auto && triggering_entity) {
+      if (const auto handle = global().entities->handle(triggering_entity);
+          handle and another_handle) {
+        return evaluateCollisionCondition(handle.value(), another_handle.value());
+      } else {
+        return evaluateCollisionCondition(triggering_entity, another_given_entity.as<EntityRef>());
+      }
+    }));
+  } else if (another_given_entity.is<ByType>()) {
     return asBoolean(triggering_entities.apply([&](auto && triggering_entity) {
-      return evaluateCollisionCondition(triggering_entity, another_given_entity.as<EntityRef>());
+      return evaluateCollisionConditionByType(
+        triggering_entity, another_given_entity.as<ByType>().type);
     }));
   } else {
-    // TODO ByType
     return false_v;
   }
 }
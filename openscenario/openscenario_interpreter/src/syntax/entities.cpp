@@ -40,6 +40,12 @@ auto Entities::isAdded(const EntityRef & entity_ref) const -> bool
   return ref(entity_ref).template as<ScenarioObject>().is_added;
 }
 
+auto Entities::handle(const EntityRef & entity_ref) const
+  -> std::optional<traffic_simulator::entity::EntityHandle>
+{
+  return ref(entity_ref).template as<ScenarioObject>().handle;
+}
+
 auto Entities::ref(const EntityRef & entity_ref) const -> Object
 {
   try {
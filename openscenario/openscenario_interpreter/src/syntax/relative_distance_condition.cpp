@@ -59,10 +59,10 @@ auto RelativeDistanceCondition::distance<
   CoordinateSystem::entity, RelativeDistanceType::longitudinal, false>(
   const EntityRef & triggering_entity) -> double
 {
-  if (
-    global().entities->at(triggering_entity).as<ScenarioObject>().is_added and
-    global().entities->at(entity_ref).as<ScenarioObject>().is_added) {
-    return std::abs(makeNativeRelativeWorldPosition(triggering_entity, entity_ref).position.x);
+  if (const auto from = global().entities->handle(triggering_entity),
+                 to = global().entities->handle(entity_ref);
+      from and to) {
+    return std::abs(makeNativeRelativeWorldPosition(from.value(), to.value()).position.x);
   } else {
     return Double::nan();
   }
@@ -73,10 +73,10 @@ auto RelativeDistanceCondition::distance<
   CoordinateSystem::entity, RelativeDistanceType::lateral, false>(
   const EntityRef & triggering_entity) -> double
 {
-  if (
-    global().entities->at(triggering_entity).as<ScenarioObject>().is_added and
-    global().entities->at(entity_ref).as<ScenarioObject>().is_added) {
-    return std::abs(makeNativeRelativeWorldPosition(triggering_entity, entity_ref).position.y);
+  if (const auto from = global().entities->handle(triggering_entity),
+                 to = global().entities->handle(entity_ref);
+      from and to) {
+    return std::abs(makeNativeRelativeWorldPosition(from.value(), to.value()).position.y);
   } else {
     return Double::nan();
   }
@@ -87,10 +87,10 @@ auto RelativeDistanceCondition::distance<
   CoordinateSystem::entity, RelativeDistanceType::euclidianDistance, true>(
   const EntityRef & triggering_entity) -> double
 {
-  if (
-    global().entities->at(triggering_entity).as<ScenarioObject>().is_added and
-    global().entities->at(entity_ref).as<ScenarioObject>().is_added) {
-    return evaluateFreespaceEuclideanDistance(triggering_entity, entity_ref);
+  if (const auto from = global().entities->handle(triggering_entity),
+                 to = global().entities->handle(entity_ref);
+      from and to) {
+    return evaluateFreespaceEuclideanDistance(from.value(), to.value());
   } else {
     return Double::nan();
   }
@@ -101,12 +101,11 @@ auto RelativeDistanceCondition::distance<
   CoordinateSystem::entity, RelativeDistanceType::euclidianDistance, false>(
   const EntityRef & triggering_entity) -> double
 {
-  if (
-    global().entities->at(triggering_entity).as<ScenarioObject>().is_added and
-    global().entities->at(entity_ref).as<ScenarioObject>().is_added) {
-    return std::hypot(
-      makeNativeRelativeWorldPosition(triggering_entity, entity_ref).position.x,
-      makeNativeRelativeWorldPosition(triggering_entity, entity_ref).position.y);
+  if (const auto from = global().entities->handle(triggering_entity),
+                 to = global().entities->handle(entity_ref);
+      from and to) {
+    const auto relative_pose = makeNativeRelativeWorldPosition(from.value(), to.value());
+    return std::hypot(relative_pose.position.x, relative_pose.position.y);
   } else {
     return Double::nan();
   }
@@ -18,12 +18,43 @@
 #include <chrono>
 #include <cstdlib>
 #include <memory>
+#include <openscenario_interpreter/syntax/object_type.hpp>
 #include <openscenario_interpreter/syntax/open_scenario.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <thread>
 
 TEST(syntax, dummy) { ASSERT_TRUE(true); }
 
+TEST(syntax, ObjectTypeMatches)
+{
+  using openscenario_interpreter::ObjectType;
+  using traffic_simulator_msgs::msg::EntityType;
+
+  const auto makeEntityType = [](auto type) {
+    EntityType entity_type;
+    entity_type.type = type;
+    return entity_type;
+  };
+
+  EXPECT_TRUE(ObjectType(ObjectType::vehicle).matches(makeEntityType(EntityType::EGO)));
+  EXPECT_TRUE(ObjectType(ObjectType::vehicle).matches(makeEntityType(EntityType::VEHICLE)));
+  EXPECT_FALSE(ObjectType(ObjectType::vehicle).matches(makeEntityType(EntityType::PEDESTRIAN)));
+  EXPECT_FALSE(ObjectType(ObjectType::vehicle).matches(makeEntityType(EntityType::MISC_OBJECT)));
+
+  EXPECT_TRUE(ObjectType(ObjectType::pedestrian).matches(makeEntityType(EntityType::PEDESTRIAN)));
+  EXPECT_FALSE(ObjectType(ObjectType::pedestrian).matches(makeEntityType(EntityType::EGO)));
+  EXPECT_FALSE(ObjectType(ObjectType::pedestrian).matches(makeEntityType(EntityType::VEHICLE)));
+  EXPECT_FALSE(
+    ObjectType(ObjectType::pedestrian).matches(makeEntityType(EntityType::MISC_OBJECT)));
+
+  EXPECT_TRUE(
+    ObjectType(ObjectType::miscellaneous).matches(makeEntityType(EntityType::MISC_OBJECT)));
+  EXPECT_FALSE(ObjectType(ObjectType::miscellaneous).matches(makeEntityType(EntityType::EGO)));
+  EXPECT_FALSE(ObjectType(ObjectType::miscellaneous).matches(makeEntityType(EntityType::VEHICLE)));
+  EXPECT_FALSE(
+    ObjectType(ObjectType::miscellaneous).matches(makeEntityType(EntityType::PEDESTRIAN)));
+}
+
 // TEST(Syntax, LexicalScope)
 // {
 //   using ament_index_cpp::get_package_share_directory;
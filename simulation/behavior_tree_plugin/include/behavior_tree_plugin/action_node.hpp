@@ -18,11 +18,14 @@
 #include <behaviortree_cpp_v3/action_node.h>
 
 #include <algorithm>
+#include <behavior_tree_plugin/action_node_context.hpp>
 #include <geometry/spline/catmull_rom_spline.hpp>
 #include <memory>
 #include <optional>
 #include <string>
 #include <traffic_simulator/behavior/behavior_plugin_base.hpp>
+#include <traffic_simulator/behavior/longitudinal_speed_planning.hpp>
+#include <traffic_simulator/behavior/tick_profiler.hpp>
 #include <traffic_simulator/data_type/behavior.hpp>
 #include <traffic_simulator/data_type/entity_status.hpp>
 #include <traffic_simulator/entity/entity_base.hpp>
@@ -62,6 +65,8 @@ public:
     -> std::vector<traffic_simulator::CanonicalizedEntityStatus>;
   auto getYieldStopDistance(const std::vector<std::int64_t> & following_lanelets) const
     -> std::optional<double>;
+  auto getEntityStatusOnLanelets(const std::vector<std::int64_t> & lanelet_ids) const
+    -> std::vector<traffic_simulator::CanonicalizedEntityStatus>;
   auto getOtherEntityStatus(std::int64_t lanelet_id) const
     -> std::vector<traffic_simulator::CanonicalizedEntityStatus>;
   auto stopEntity() const -> void;
@@ -70,6 +75,7 @@ public:
   auto getEntityName() const noexcept -> std::string;
 
   /// throws if the derived class return RUNNING.
+  /// @note Records the duration of the tick by node type if the TickProfiler is enabled.
   auto executeTick() -> BT::NodeStatus override;
 
   void halt() override final { setStatus(BT::NodeStatus::IDLE); }
@@ -111,6 +117,7 @@ public:
     -> traffic_simulator::CanonicalizedEntityStatus;
 
 protected:
+  const std::shared_ptr<const ActionNodeContext> context;
   traffic_simulator::behavior::Request request;
   std::shared_ptr<hdmap_utils::HdMapUtils> hdmap_utils;
   std::shared_ptr<traffic_simulator::TrafficLightManager> traffic_light_manager;
@@ -119,11 +126,12 @@ protected:
   double step_time;
   std::optional<double> target_speed;
   std::shared_ptr<traffic_simulator::CanonicalizedEntityStatus> updated_status;
-  EntityStatusDict other_entity_status;
-  std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> entity_type_list;
-  std::vector<std::int64_t> route_lanelets;
+  const EntityStatusDict & other_entity_status;
+  const EntityTypeDict & entity_type_list;
+  const std::vector<std::int64_t> & route_lanelets;
 
 private:
+  auto getFrontEntityCandidates() const -> std::vector<const EntityStatusDict::value_type *>;
   auto getDistanceToTargetEntityOnCrosswalk(
     const math::geometry::CatmullRomSplineInterface & spline,
     const traffic_simulator::CanonicalizedEntityStatus & status) const -> std::optional<double>;
@@ -138,6 +146,13 @@ private:
     -> std::vector<traffic_simulator::CanonicalizedEntityStatus>;
   auto getConflictingEntityStatusOnLane(const std::vector<std::int64_t> & route_lanelets) const
     -> std::vector<traffic_simulator::CanonicalizedEntityStatus>;
+
+  /// @note Kept across ticks, and replaced only when the tree is reused for another entity.
+  std::optional<traffic_simulator::longitudinal_speed_planning::LongitudinalSpeedPlanner>
+    speed_planner;
+
+  /// @note Resolved on the first profiled tick, since the registration name is set after creation.
+  traffic_simulator::behavior::TickProfiler::Statistics * tick_statistics = nullptr;
 };
 }  // namespace entity_behavior
 
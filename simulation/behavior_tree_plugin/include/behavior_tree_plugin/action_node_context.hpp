@@ -0,0 +1,56 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BEHAVIOR_TREE_PLUGIN__ACTION_NODE_CONTEXT_HPP_
+#define BEHAVIOR_TREE_PLUGIN__ACTION_NODE_CONTEXT_HPP_
+
+#include <cstdint>
+#include <string>
+#include <traffic_simulator/behavior/behavior_plugin_base.hpp>
+#include <traffic_simulator_msgs/msg/behavior_parameter.hpp>
+#include <traffic_simulator_msgs/msg/pedestrian_parameters.hpp>
+#include <traffic_simulator_msgs/msg/vehicle_parameters.hpp>
+#include <vector>
+
+namespace entity_behavior
+{
+/**
+ * @brief Inputs of the action nodes which are too large to be copied out of the blackboard on every
+ * tick. The behavior tree plugin owns one context per entity and stores it in the root blackboard
+ * before the tree is created, and the action nodes refer to its members by const reference.
+ * @note The ports of these inputs are still provided, so that the tree XML does not change.
+ */
+struct ActionNodeContext
+{
+  static auto key() -> const std::string &
+  {
+    static const std::string key = "action_node_context";
+    return key;
+  }
+
+  EntityStatusDict other_entity_status;
+
+  EntityTypeDict entity_type_list;
+
+  std::vector<std::int64_t> route_lanelets;
+
+  traffic_simulator_msgs::msg::BehaviorParameter behavior_parameter;
+
+  traffic_simulator_msgs::msg::VehicleParameters vehicle_parameters;
+
+  traffic_simulator_msgs::msg::PedestrianParameters pedestrian_parameters;
+};
+}  // namespace entity_behavior
+
+#endif  // BEHAVIOR_TREE_PLUGIN__ACTION_NODE_CONTEXT_HPP_
@@ -18,8 +18,10 @@
 #include <behaviortree_cpp_v3/bt_factory.h>
 #include <behaviortree_cpp_v3/loggers/bt_cout_logger.h>
 
+#include <behavior_tree_plugin/action_node_context.hpp>
 #include <behavior_tree_plugin/pedestrian/follow_lane_action.hpp>
 #include <behavior_tree_plugin/pedestrian/walk_straight_action.hpp>
+#include <behavior_tree_plugin/pedestrian/walk_with_social_force_action.hpp>
 #include <behavior_tree_plugin/transition_events/transition_events.hpp>
 #include <functional>
 #include <geometry_msgs/msg/point.hpp>
@@ -39,6 +41,7 @@ class PedestrianBehaviorTree : public BehaviorPluginBase
 {
 public:
   void configure(const rclcpp::Logger & logger) override;
+  auto reset(const rclcpp::Logger & logger) -> bool override;
   void update(double current_time, double step_time) override;
   const std::string & getCurrentAction() const override;
 #define DEFINE_GETTER_SETTER(NAME, TYPE)                                                    \
@@ -48,36 +51,46 @@ public:
     tree_.rootBlackboard()->set<TYPE>(get##NAME##Key(), value);                             \
   }
 
+#define DEFINE_CONTEXT_GETTER_SETTER(NAME, TYPE, FIELD) \
+  TYPE get##NAME() override { return context_->FIELD; } \
+  void set##NAME(const TYPE & value) override { context_->FIELD = value; }
+
   // clang-format off
-  DEFINE_GETTER_SETTER(BehaviorParameter,                 traffic_simulator_msgs::msg::BehaviorParameter)
-  DEFINE_GETTER_SETTER(CurrentTime,                       double)
-  DEFINE_GETTER_SETTER(DebugMarker,                       std::vector<visualization_msgs::msg::Marker>)
-  DEFINE_GETTER_SETTER(EntityTypeList,                    EntityTypeDict)
-  DEFINE_GETTER_SETTER(GoalPoses,                         std::vector<geometry_msgs::msg::Pose>)
-  DEFINE_GETTER_SETTER(EntityStatus,                      std::shared_ptr<traffic_simulator::CanonicalizedEntityStatus>)
-  DEFINE_GETTER_SETTER(PolylineTrajectory,                std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory>)
-  DEFINE_GETTER_SETTER(HdMapUtils,                        std::shared_ptr<hdmap_utils::HdMapUtils>)
-  DEFINE_GETTER_SETTER(LaneChangeParameters,              traffic_simulator::lane_change::Parameter)
-  DEFINE_GETTER_SETTER(Obstacle,                          std::optional<traffic_simulator_msgs::msg::Obstacle>)
-  DEFINE_GETTER_SETTER(OtherEntityStatus,                 EntityStatusDict)
-  DEFINE_GETTER_SETTER(PedestrianParameters,              traffic_simulator_msgs::msg::PedestrianParameters)
-  DEFINE_GETTER_SETTER(ReferenceTrajectory,               std::shared_ptr<math::geometry::CatmullRomSpline>)
-  DEFINE_GETTER_SETTER(Request,                           traffic_simulator::behavior::Request)
-  DEFINE_GETTER_SETTER(RouteLanelets,                     std::vector<std::int64_t>)
-  DEFINE_GETTER_SETTER(StepTime,                          double)
-  DEFINE_GETTER_SETTER(TargetSpeed,                       std::optional<double>)
-  DEFINE_GETTER_SETTER(TrafficLightManager,               std::shared_ptr<traffic_simulator::TrafficLightManager>)
-  DEFINE_GETTER_SETTER(UpdatedStatus,                     std::shared_ptr<traffic_simulator::CanonicalizedEntityStatus>)
-  DEFINE_GETTER_SETTER(VehicleParameters,                 traffic_simulator_msgs::msg::VehicleParameters)
-  DEFINE_GETTER_SETTER(Waypoints,                         traffic_simulator_msgs::msg::WaypointsArray)
+  DEFINE_CONTEXT_GETTER_SETTER(BehaviorParameter,        traffic_simulator_msgs::msg::BehaviorParameter, behavior_parameter)
+  DEFINE_GETTER_SETTER(CurrentTime,                      double)
+  DEFINE_GETTER_SETTER(DebugMarker,                      std::vector<visualization_msgs::msg::Marker>)
+  DEFINE_CONTEXT_GETTER_SETTER(EntityTypeList,           EntityTypeDict, entity_type_list)
+  DEFINE_GETTER_SETTER(GoalPoses,                        std::vector<geometry_msgs::msg::Pose>)
+  DEFINE_GETTER_SETTER(EntityStatus,                     std::shared_ptr<traffic_simulator::CanonicalizedEntityStatus>)
+  DEFINE_GETTER_SETTER(PolylineTrajectory,               std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory>)
+  DEFINE_GETTER_SETTER(HdMapUtils,                       std::shared_ptr<hdmap_utils::HdMapUtils>)
+  DEFINE_GETTER_SETTER(LaneChangeParameters,             traffic_simulator::lane_change::Parameter)
+  DEFINE_GETTER_SETTER(Obstacle,                         std::optional<traffic_simulator_msgs::msg::Obstacle>)
+  DEFINE_CONTEXT_GETTER_SETTER(OtherEntityStatus,        EntityStatusDict, other_entity_status)
+  DEFINE_CONTEXT_GETTER_SETTER(PedestrianParameters,     traffic_simulator_msgs::msg::PedestrianParameters, pedestrian_parameters)
+  DEFINE_GETTER_SETTER(ReferenceTrajectory,              std::shared_ptr<math::geometry::CatmullRomSpline>)
+  DEFINE_GETTER_SETTER(Request,                          traffic_simulator::behavior::Request)
+  DEFINE_CONTEXT_GETTER_SETTER(RouteLanelets,            std::vector<std::int64_t>, route_lanelets)
+  DEFINE_GETTER_SETTER(StepTime,                         double)
+  DEFINE_GETTER_SETTER(TargetSpeed,                      std::optional<double>)
+  DEFINE_GETTER_SETTER(TrafficLightManager,              std::shared_ptr<traffic_simulator::TrafficLightManager>)
+  DEFINE_GETTER_SETTER(UpdatedStatus,                    std::shared_ptr<traffic_simulator::CanonicalizedEntityStatus>)
+  DEFINE_CONTEXT_GETTER_SETTER(VehicleParameters,        traffic_simulator_msgs::msg::VehicleParameters, vehicle_parameters)
+  DEFINE_GETTER_SETTER(Waypoints,                        traffic_simulator_msgs::msg::WaypointsArray)
   // clang-format on
 
 #undef DEFINE_GETTER_SETTER
+#undef DEFINE_CONTEXT_GETTER_SETTER
 
 private:
   BT::NodeStatus tickOnce(double current_time, double step_time);
-  auto createBehaviorTree(const std::string & format_path) -> BT::Tree;
-  BT::BehaviorTreeFactory factory_;
+  static auto getBehaviorTreeID() -> const std::string &;
+  static auto getFactory() -> const std::shared_ptr<BT::BehaviorTreeFactory> &;
+  static auto registerBehaviorTree(BT::BehaviorTreeFactory &, const std::string & format_path)
+    -> void;
+  auto createBehaviorTree() -> BT::Tree;
+  const std::shared_ptr<BT::BehaviorTreeFactory> factory_ = getFactory();
+  const std::shared_ptr<ActionNodeContext> context_ = std::make_shared<ActionNodeContext>();
   BT::Tree tree_;
   std::unique_ptr<behavior_tree_plugin::LoggingEvent> logging_event_ptr_;
   std::unique_ptr<behavior_tree_plugin::ResetRequestEvent> reset_request_event_ptr_;
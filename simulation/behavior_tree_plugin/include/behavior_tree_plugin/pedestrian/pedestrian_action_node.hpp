@@ -43,14 +43,18 @@ public:
     }
     return ports;
   }
-  traffic_simulator_msgs::msg::PedestrianParameters pedestrian_parameters;
+  const traffic_simulator_msgs::msg::PedestrianParameters & pedestrian_parameters;
   auto calculateUpdatedEntityStatusInWorldFrame(double target_speed) const
     -> traffic_simulator::CanonicalizedEntityStatus;
   auto calculateUpdatedEntityStatus(double target_speed) const
     -> traffic_simulator::CanonicalizedEntityStatus;
 
 protected:
-  traffic_simulator_msgs::msg::BehaviorParameter behavior_parameter;
+  const traffic_simulator_msgs::msg::BehaviorParameter & behavior_parameter;
+
+  /// @note Canonicalizes a status updated in the world frame by matching it to a lanelet.
+  auto canonicalizeInWorldFrame(traffic_simulator::EntityStatus) const
+    -> traffic_simulator::CanonicalizedEntityStatus;
 
 private:
   auto estimateLaneletPose(const geometry_msgs::msg::Pose & pose) const
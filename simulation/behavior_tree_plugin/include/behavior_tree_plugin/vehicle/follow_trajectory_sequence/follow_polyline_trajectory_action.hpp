@@ -16,6 +16,8 @@
 #define BEHAVIOR_TREE_PLUGIN__VEHICLE__FOLLOW_POLYLINE_TRAJECTORY_ACTION_HPP_
 
 #include <behavior_tree_plugin/vehicle/vehicle_action_node.hpp>
+#include <optional>
+#include <traffic_simulator/behavior/follow_trajectory.hpp>
 
 namespace entity_behavior
 {
@@ -27,6 +29,9 @@ struct FollowPolylineTrajectoryAction : public VehicleActionNode
 
   std::optional<double> target_speed;
 
+  /// @note Waypoints of polyline_trajectory not passed yet, reset when the trajectory is replaced.
+  std::optional<traffic_simulator::follow_trajectory::Cursor> cursor;
+
   using VehicleActionNode::VehicleActionNode;
 
   auto calculateWaypoints() -> const traffic_simulator_msgs::msg::WaypointsArray override;
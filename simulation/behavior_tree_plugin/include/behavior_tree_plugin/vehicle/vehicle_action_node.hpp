@@ -62,8 +62,8 @@ public:
     const traffic_simulator_msgs::msg::WaypointsArray & waypoints) = 0;
 
 protected:
-  traffic_simulator_msgs::msg::BehaviorParameter behavior_parameter;
-  traffic_simulator_msgs::msg::VehicleParameters vehicle_parameters;
+  const traffic_simulator_msgs::msg::BehaviorParameter & behavior_parameter;
+  const traffic_simulator_msgs::msg::VehicleParameters & vehicle_parameters;
   std::shared_ptr<math::geometry::CatmullRomSpline> reference_trajectory;
   std::unique_ptr<math::geometry::CatmullRomSubspline> trajectory;
 };
@@ -16,6 +16,8 @@
 
 #include <algorithm>
 #include <behavior_tree_plugin/action_node.hpp>
+#include <chrono>
+#include <cmath>
 #include <geometry/bounding_box.hpp>
 #include <memory>
 #include <optional>
@@ -31,12 +33,44 @@
 
 namespace entity_behavior
 {
+namespace
+{
+auto getActionNodeContext(const BT::NodeConfiguration & config)
+  -> std::shared_ptr<const ActionNodeContext>
+{
+  if (std::shared_ptr<ActionNodeContext> context;
+      config.blackboard and config.blackboard->get(ActionNodeContext::key(), context) and context) {
+    return context;
+  } else {
+    THROW_SIMULATION_ERROR("failed to get ", ActionNodeContext::key(), " in ActionNode");
+  }
+}
+}  // namespace
+
 ActionNode::ActionNode(const std::string & name, const BT::NodeConfiguration & config)
-: BT::ActionNodeBase(name, config)
+: BT::ActionNodeBase(name, config),
+  context(getActionNodeContext(config)),
+  other_entity_status(context->other_entity_status),
+  entity_type_list(context->entity_type_list),
+  route_lanelets(context->route_lanelets)
 {
 }
 
-auto ActionNode::executeTick() -> BT::NodeStatus { return BT::ActionNodeBase::executeTick(); }
+auto ActionNode::executeTick() -> BT::NodeStatus
+{
+  if (auto & profiler = traffic_simulator::behavior::TickProfiler::get();
+      not profiler.isEnabled()) {
+    return BT::ActionNodeBase::executeTick();
+  } else {
+    if (not tick_statistics) {
+      tick_statistics = &profiler.getStatistics(registrationName());
+    }
+    const auto start = std::chrono::steady_clock::now();
+    const auto status = BT::ActionNodeBase::executeTick();
+    tick_statistics->record(std::chrono::steady_clock::now() - start);
+    return status;
+  }
+}
 
 auto ActionNode::getBlackBoardValues() -> void
 {
@@ -60,21 +94,15 @@ auto ActionNode::getBlackBoardValues() -> void
         "entity_status", entity_status)) {
     THROW_SIMULATION_ERROR("failed to get input entity_status in ActionNode");
   }
+  if (speed_planner and speed_planner->getEntity() == entity_status->getName()) {
+    speed_planner->setStepTime(step_time);
+  } else {
+    speed_planner.emplace(step_time, entity_status->getName());
+  }
 
   if (!getInput<std::optional<double>>("target_speed", target_speed)) {
     target_speed = std::nullopt;
   }
-
-  if (!getInput<EntityStatusDict>("other_entity_status", other_entity_status)) {
-    THROW_SIMULATION_ERROR("failed to get input other_entity_status in ActionNode");
-  }
-  if (!getInput<std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>>(
-        "entity_type_list", entity_type_list)) {
-    THROW_SIMULATION_ERROR("failed to get input entity_type_list in ActionNode");
-  }
-  if (!getInput<std::vector<std::int64_t>>("route_lanelets", route_lanelets)) {
-    THROW_SIMULATION_ERROR("failed to get input route_lanelets in ActionNode");
-  }
 }
 
 auto ActionNode::getHorizon() const -> double
@@ -93,12 +121,8 @@ auto ActionNode::getOtherEntityStatus(std::int64_t lanelet_id) const
   -> std::vector<traffic_simulator::CanonicalizedEntityStatus>
 {
   std::vector<traffic_simulator::CanonicalizedEntityStatus> ret;
-  for (const auto & status : other_entity_status) {
-    if (
-      status.second.laneMatchingSucceed() &&
-      traffic_simulator::isSameLaneletId(status.second, lanelet_id)) {
-      ret.emplace_back(status.second);
-    }
+  for (const auto & status : other_entity_status.getEntitiesOnLanelets({lanelet_id})) {
+    ret.emplace_back(status->second);
   }
   return ret;
 }
@@ -106,23 +130,21 @@ auto ActionNode::getOtherEntityStatus(std::int64_t lanelet_id) const
 auto ActionNode::getYieldStopDistance(const std::vector<std::int64_t> & following_lanelets) const
   -> std::optional<double>
 {
-  std::set<double> distances;
+  if (!entity_status->laneMatchingSucceed()) {
+    return std::nullopt;
+  }
+  /**
+   * @note The distance only depends on the following lanelet, so it is calculated once if any of
+   * its right of way lanelets is occupied by another entity.
+   */
   for (const auto & lanelet : following_lanelets) {
-    const auto right_of_way_ids = hdmap_utils->getRightOfWayLaneletIds(lanelet);
-    for (const auto right_of_way_id : right_of_way_ids) {
-      const auto other_status = getOtherEntityStatus(right_of_way_id);
-      if (!other_status.empty() && entity_status->laneMatchingSucceed()) {
-        const auto lanelet_pose = entity_status->getLaneletPose();
-        auto distance = hdmap_utils->getLongitudinalDistance(
-          lanelet_pose, traffic_simulator::helper::constructLaneletPose(lanelet, 0));
-        if (distance) {
-          distances.insert(distance.value());
-        }
+    if (other_entity_status.existsOnLanelets(hdmap_utils->getRightOfWayLaneletIds(lanelet))) {
+      if (const auto distance = hdmap_utils->getLongitudinalDistance(
+            entity_status->getLaneletPose(),
+            traffic_simulator::helper::constructLaneletPose(lanelet, 0))) {
+        return distance;
       }
     }
-    if (distances.size() != 0) {
-      return *distances.begin();
-    }
   }
   return std::nullopt;
 }
@@ -130,20 +152,14 @@ auto ActionNode::getYieldStopDistance(const std::vector<std::int64_t> & followin
 auto ActionNode::getRightOfWayEntities(const std::vector<std::int64_t> & following_lanelets) const
   -> std::vector<traffic_simulator::CanonicalizedEntityStatus>
 {
-  std::vector<traffic_simulator::CanonicalizedEntityStatus> ret;
+  std::vector<std::int64_t> lanelet_ids;
   const auto lanelet_ids_list = hdmap_utils->getRightOfWayLaneletIds(following_lanelets);
-  for (const auto & status : other_entity_status) {
-    for (const auto & following_lanelet : following_lanelets) {
-      for (const std::int64_t & lanelet_id : lanelet_ids_list.at(following_lanelet)) {
-        if (
-          status.second.laneMatchingSucceed() &&
-          traffic_simulator::isSameLaneletId(status.second, lanelet_id)) {
-          ret.emplace_back(status.second);
-        }
-      }
-    }
+  for (const auto & following_lanelet : following_lanelets) {
+    const auto & right_of_way_lanelet_ids = lanelet_ids_list.at(following_lanelet);
+    lanelet_ids.insert(
+      lanelet_ids.end(), right_of_way_lanelet_ids.begin(), right_of_way_lanelet_ids.end());
   }
-  return ret;
+  return getEntityStatusOnLanelets(lanelet_ids);
 }
 
 auto ActionNode::getRightOfWayEntities() const
@@ -152,19 +168,23 @@ auto ActionNode::getRightOfWayEntities() const
   if (!entity_status->laneMatchingSucceed()) {
     return {};
   }
+  return getEntityStatusOnLanelets(
+    hdmap_utils->getRightOfWayLaneletIds(entity_status->getLaneletPose().lanelet_id));
+}
+
+auto ActionNode::getEntityStatusOnLanelets(const std::vector<std::int64_t> & lanelet_ids) const
+  -> std::vector<traffic_simulator::CanonicalizedEntityStatus>
+{
+  /**
+   * @note An entity appears as many times as its lanelet appears in lanelet_ids, in the same way as
+   * checking every pair of other entities and lanelet_ids.
+   */
   std::vector<traffic_simulator::CanonicalizedEntityStatus> ret;
-  const auto lanelet_ids =
-    hdmap_utils->getRightOfWayLaneletIds(entity_status->getLaneletPose().lanelet_id);
-  if (lanelet_ids.empty()) {
-    return ret;
-  }
-  for (const auto & status : other_entity_status) {
-    for (const std::int64_t & lanelet_id : lanelet_ids) {
-      if (
-        status.second.laneMatchingSucceed() &&
-        traffic_simulator::isSameLaneletId(status.second, lanelet_id)) {
-        ret.emplace_back(status.second);
-      }
+  for (const auto & status : other_entity_status.getEntitiesOnLanelets(lanelet_ids)) {
+    const auto lanelet_id = status->second.getLaneletPose().lanelet_id;
+    for (auto count = std::count(lanelet_ids.begin(), lanelet_ids.end(), lanelet_id); count > 0;
+         --count) {
+      ret.emplace_back(status->second);
     }
   }
   return ret;
@@ -220,19 +240,25 @@ auto ActionNode::getFrontEntityName(const math::geometry::CatmullRomSplineInterf
 {
   std::vector<double> distances;
   std::vector<std::string> entities;
-  for (const auto & each : other_entity_status) {
-    const auto distance = getDistanceToTargetEntityPolygon(spline, each.first);
+  for (const auto & each : getFrontEntityCandidates()) {
+    /**
+     * @note Entities which are not lane matched never have a distance, so they are skipped before
+     * the heading check and the spline-polygon collision check, which is the most expensive.
+     */
+    if (!each->second.laneMatchingSucceed()) {
+      continue;
+    }
     const auto quat = quaternion_operation::getRotation(
-      entity_status->getMapPose().orientation,
-      other_entity_status.at(each.first).getMapPose().orientation);
+      entity_status->getMapPose().orientation, each->second.getMapPose().orientation);
     /**
      * @note hard-coded parameter, if the Yaw value of RPY is in ~1.5708 -> 1.5708, entity is a candidate of front entity.
      */
     if (
       std::fabs(quaternion_operation::convertQuaternionToEulerAngle(quat).z) <=
       boost::math::constants::half_pi<double>()) {
-      if (distance && distance.value() < 40) {
-        entities.emplace_back(each.first);
+      if (const auto distance = getDistanceToTargetEntityPolygon(spline, each->second);
+          distance && distance.value() < 40) {
+        entities.emplace_back(each->first);
         distances.emplace_back(distance.value());
       }
     }
@@ -248,6 +274,28 @@ auto ActionNode::getFrontEntityName(const math::geometry::CatmullRomSplineInterf
   return entities[index];
 }
 
+auto ActionNode::getFrontEntityCandidates() const
+  -> std::vector<const EntityStatusDict::value_type *>
+{
+  if (entity_status->laneMatchingSucceed()) {
+    /**
+     * @note The spline given to getFrontEntityName starts at the lanelet pose of this entity, and
+     * only entities colliding with the first 40m of it are candidates. So entities farther than
+     * 40m plus the lateral offset of this entity and the size of their bounding box can not be a
+     * front entity. 1m of margin is added for the difference between the spline and the lanelet.
+     */
+    const auto radius = 40.0 + std::abs(entity_status->getLaneletPose().offset) +
+                        other_entity_status.getMaximumBoundingRadius() + 1.0;
+    return other_entity_status.getEntitiesWithin(entity_status->getMapPose().position, radius);
+  } else {
+    std::vector<const EntityStatusDict::value_type *> candidates;
+    for (const auto & each : other_entity_status) {
+      candidates.push_back(&each);
+    }
+    return candidates;
+  }
+}
+
 auto ActionNode::getDistanceToTargetEntityOnCrosswalk(
   const math::geometry::CatmullRomSplineInterface & spline,
   const traffic_simulator::CanonicalizedEntityStatus & status) const -> std::optional<double>
@@ -329,14 +377,8 @@ auto ActionNode::getConflictingEntityStatusOnCrossWalk(
 {
   std::vector<traffic_simulator::CanonicalizedEntityStatus> conflicting_entity_status;
   auto conflicting_crosswalks = hdmap_utils->getConflictingCrosswalkIds(route_lanelets);
-  for (const auto & status : other_entity_status) {
-    if (
-      status.second.laneMatchingSucceed() &&
-      std::count(
-        conflicting_crosswalks.begin(), conflicting_crosswalks.end(),
-        status.second.getLaneletPose().lanelet_id) >= 1) {
-      conflicting_entity_status.emplace_back(status.second);
-    }
+  for (const auto & status : other_entity_status.getEntitiesOnLanelets(conflicting_crosswalks)) {
+    conflicting_entity_status.emplace_back(status->second);
   }
   return conflicting_entity_status;
 }
@@ -346,13 +388,8 @@ auto ActionNode::getConflictingEntityStatusOnLane(const std::vector<std::int64_t
 {
   std::vector<traffic_simulator::CanonicalizedEntityStatus> conflicting_entity_status;
   auto conflicting_lanes = hdmap_utils->getConflictingLaneIds(route_lanelets);
-  for (const auto & status : other_entity_status) {
-    if (
-      status.second.laneMatchingSucceed() && std::count(
-                                               conflicting_lanes.begin(), conflicting_lanes.end(),
-                                               status.second.getLaneletPose().lanelet_id) >= 1) {
-      conflicting_entity_status.emplace_back(status.second);
-    }
+  for (const auto & status : other_entity_status.getEntitiesOnLanelets(conflicting_lanes)) {
+    conflicting_entity_status.emplace_back(status->second);
   }
   return conflicting_entity_status;
 }
@@ -362,32 +399,15 @@ auto ActionNode::foundConflictingEntity(const std::vector<std::int64_t> & follow
 {
   auto conflicting_crosswalks = hdmap_utils->getConflictingCrosswalkIds(following_lanelets);
   auto conflicting_lanes = hdmap_utils->getConflictingLaneIds(following_lanelets);
-  for (const auto & status : other_entity_status) {
-    if (
-      status.second.laneMatchingSucceed() &&
-      std::count(
-        conflicting_crosswalks.begin(), conflicting_crosswalks.end(),
-        status.second.getLaneletPose().lanelet_id) >= 1) {
-      return true;
-    }
-    if (
-      status.second.laneMatchingSucceed() && std::count(
-                                               conflicting_lanes.begin(), conflicting_lanes.end(),
-                                               status.second.getLaneletPose().lanelet_id) >= 1) {
-      return true;
-    }
-  }
-  return false;
+  return other_entity_status.existsOnLanelets(conflicting_crosswalks) or
+         other_entity_status.existsOnLanelets(conflicting_lanes);
 }
 
 auto ActionNode::calculateUpdatedEntityStatus(
   double target_speed, const traffic_simulator_msgs::msg::DynamicConstraints & constraints) const
   -> traffic_simulator::CanonicalizedEntityStatus
 {
-  const auto speed_planner =
-    traffic_simulator::longitudinal_speed_planning::LongitudinalSpeedPlanner(
-      step_time, getEntityName());
-  const auto dynamics = speed_planner.getDynamicStates(
+  const auto dynamics = speed_planner->getDynamicStates(
     target_speed, constraints, entity_status->getTwist(), entity_status->getAccel());
 
   double linear_jerk_new = std::get<2>(dynamics);
@@ -463,10 +483,7 @@ auto ActionNode::calculateUpdatedEntityStatusInWorldFrame(
   double target_speed, const traffic_simulator_msgs::msg::DynamicConstraints & constraints) const
   -> traffic_simulator::CanonicalizedEntityStatus
 {
-  const auto speed_planner =
-    traffic_simulator::longitudinal_speed_planning::LongitudinalSpeedPlanner(
-      step_time, getEntityName());
-  const auto dynamics = speed_planner.getDynamicStates(
+  const auto dynamics = speed_planner->getDynamicStates(
     target_speed, constraints, entity_status->getTwist(), entity_status->getAccel());
   double linear_jerk_new = std::get<2>(dynamics);
   geometry_msgs::msg::Accel accel_new = std::get<1>(dynamics);
@@ -501,11 +518,9 @@ auto ActionNode::calculateUpdatedEntityStatusInWorldFrame(
 auto ActionNode::calculateStopDistance(
   const traffic_simulator_msgs::msg::DynamicConstraints & constraints) const -> double
 {
-  return traffic_simulator::longitudinal_speed_planning::LongitudinalSpeedPlanner(
-           step_time, getEntityName())
-    .getRunningDistance(
-      0, constraints, entity_status->getTwist(), entity_status->getAccel(),
-      entity_status->getLinearJerk());
+  return speed_planner->getRunningDistance(
+    0, constraints, entity_status->getTwist(), entity_status->getAccel(),
+    entity_status->getLinearJerk());
 }
 
 auto ActionNode::getActionStatus() const noexcept -> traffic_simulator_msgs::msg::ActionStatus
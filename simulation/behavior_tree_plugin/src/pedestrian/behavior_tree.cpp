@@ -23,15 +23,34 @@
 
 namespace entity_behavior
 {
-void PedestrianBehaviorTree::configure(const rclcpp::Logger & logger)
+auto PedestrianBehaviorTree::getBehaviorTreeID() -> const std::string &
 {
-  namespace pedestrian = entity_behavior::pedestrian;
-  factory_.registerNodeType<pedestrian::FollowLaneAction>("FollowLane");
-  factory_.registerNodeType<pedestrian::WalkStraightAction>("WalkStraightAction");
+  static const std::string id = "PedestrianBehaviorTree";
+  return id;
+}
 
-  auto base_path = ament_index_cpp::get_package_share_directory("behavior_tree_plugin");
-  auto format_path = base_path + "/config/pedestrian_entity_behavior.xml";
-  tree_ = createBehaviorTree(format_path);
+auto PedestrianBehaviorTree::getFactory() -> const std::shared_ptr<BT::BehaviorTreeFactory> &
+{
+  /**
+   * @note Registering the nodes and parsing the port annotated tree definition is done once per
+   * process. Each entity instantiates its own tree from the definition registered in the factory.
+   */
+  static const auto factory = []() {
+    namespace pedestrian = entity_behavior::pedestrian;
+    auto factory = std::make_shared<BT::BehaviorTreeFactory>();
+    factory->registerNodeType<pedestrian::FollowLaneAction>("FollowLane");
+    factory->registerNodeType<pedestrian::WalkStraightAction>("WalkStraightAction");
+    factory->registerNodeType<pedestrian::WalkWithSocialForceAction>("WalkWithSocialForce");
+    auto base_path = ament_index_cpp::get_package_share_directory("behavior_tree_plugin");
+    registerBehaviorTree(*factory, base_path + "/config/pedestrian_entity_behavior.xml");
+    return factory;
+  }();
+  return factory;
+}
+
+void PedestrianBehaviorTree::configure(const rclcpp::Logger & logger)
+{
+  tree_ = createBehaviorTree();
   logging_event_ptr_ =
     std::make_unique<behavior_tree_plugin::LoggingEvent>(tree_.rootNode(), logger);
   reset_request_event_ptr_ = std::make_unique<behavior_tree_plugin::ResetRequestEvent>(
@@ -40,7 +59,22 @@ void PedestrianBehaviorTree::configure(const rclcpp::Logger & logger)
   setRequest(traffic_simulator::behavior::Request::NONE);
 }
 
-auto PedestrianBehaviorTree::createBehaviorTree(const std::string & format_path) -> BT::Tree
+auto PedestrianBehaviorTree::reset(const rclcpp::Logger & logger) -> bool
+{
+  /**
+   * @note Action nodes keep the state of the previous entity in their members, which halting the
+   * tree does not clear, so the tree is created again from the shared factory.
+   */
+  tree_.haltTree();
+  logging_event_ptr_.reset();
+  reset_request_event_ptr_.reset();
+  *context_ = ActionNodeContext();
+  configure(logger);
+  return true;
+}
+
+auto PedestrianBehaviorTree::registerBehaviorTree(
+  BT::BehaviorTreeFactory & factory, const std::string & format_path) -> void
 {
   auto xml_doc = pugi::xml_document();
   xml_doc.load_file(format_path.c_str());
@@ -64,16 +98,27 @@ auto PedestrianBehaviorTree::createBehaviorTree(const std::string & format_path)
     const BT::TreeNodeManifest & manifest_;
   };
 
-  for (const auto & [id, manifest] : factory_.manifests()) {
-    if (factory_.builtinNodes().count(id) == 0) {
+  for (const auto & [id, manifest] : factory.manifests()) {
+    if (factory.builtinNodes().count(id) == 0) {
       auto walker = XMLTreeWalker(manifest);
       xml_doc.traverse(walker);
     }
   }
 
+  auto behavior_tree = xml_doc.child("root").child("BehaviorTree");
+  behavior_tree.remove_attribute("ID");
+  behavior_tree.append_attribute("ID") = getBehaviorTreeID().c_str();
+
   auto xml_str = std::stringstream();
   xml_doc.save(xml_str);
-  return factory_.createTreeFromText(xml_str.str());
+  factory.registerBehaviorTreeFromText(xml_str.str());
+}
+
+auto PedestrianBehaviorTree::createBehaviorTree() -> BT::Tree
+{
+  auto blackboard = BT::Blackboard::create();
+  blackboard->set(ActionNodeContext::key(), context_);
+  return factory_->createTree(getBehaviorTreeID(), blackboard);
 }
 
 const std::string & PedestrianBehaviorTree::getCurrentAction() const
@@ -23,21 +23,15 @@ namespace entity_behavior
 {
 PedestrianActionNode::PedestrianActionNode(
   const std::string & name, const BT::NodeConfiguration & config)
-: ActionNode(name, config)
+: ActionNode(name, config),
+  pedestrian_parameters(context->pedestrian_parameters),
+  behavior_parameter(context->behavior_parameter)
 {
 }
 
 void PedestrianActionNode::getBlackBoardValues()
 {
   ActionNode::getBlackBoardValues();
-  if (!getInput<traffic_simulator_msgs::msg::BehaviorParameter>(
-        "behavior_parameter", behavior_parameter)) {
-    behavior_parameter = traffic_simulator_msgs::msg::BehaviorParameter();
-  }
-  if (!getInput<traffic_simulator_msgs::msg::PedestrianParameters>(
-        "pedestrian_parameters", pedestrian_parameters)) {
-    THROW_SIMULATION_ERROR("failed to get input pedestrian_parameters in PedestrianActionNode");
-  }
 }
 
 auto PedestrianActionNode::calculateUpdatedEntityStatus(double target_speed) const
@@ -50,9 +44,15 @@ auto PedestrianActionNode::calculateUpdatedEntityStatus(double target_speed) con
 auto PedestrianActionNode::calculateUpdatedEntityStatusInWorldFrame(double target_speed) const
   -> traffic_simulator::CanonicalizedEntityStatus
 {
-  auto updated_status = static_cast<traffic_simulator::EntityStatus>(
+  return canonicalizeInWorldFrame(static_cast<traffic_simulator::EntityStatus>(
     ActionNode::calculateUpdatedEntityStatusInWorldFrame(
-      target_speed, behavior_parameter.dynamic_constraints));
+      target_speed, behavior_parameter.dynamic_constraints)));
+}
+
+auto PedestrianActionNode::canonicalizeInWorldFrame(
+  traffic_simulator::EntityStatus updated_status) const
+  -> traffic_simulator::CanonicalizedEntityStatus
+{
   const auto lanelet_pose = estimateLaneletPose(updated_status.pose);
   if (lanelet_pose) {
     updated_status.lanelet_pose_valid = true;
@@ -0,0 +1,54 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <behavior_tree_plugin/pedestrian/walk_with_social_force_action.hpp>
+#include <string>
+#include <traffic_simulator/behavior/social_force.hpp>
+
+namespace entity_behavior
+{
+namespace pedestrian
+{
+WalkWithSocialForceAction::WalkWithSocialForceAction(
+  const std::string & name, const BT::NodeConfiguration & config)
+: entity_behavior::PedestrianActionNode(name, config)
+{
+}
+
+void WalkWithSocialForceAction::getBlackBoardValues()
+{
+  PedestrianActionNode::getBlackBoardValues();
+}
+
+BT::NodeStatus WalkWithSocialForceAction::tick()
+{
+  getBlackBoardValues();
+  if (
+    request != traffic_simulator::behavior::Request::WALK_STRAIGHT or
+    not behavior_parameter.avoid_entities) {
+    return BT::NodeStatus::FAILURE;
+  }
+  if (!target_speed) {
+    target_speed = 1.111;
+  }
+  setOutput(
+    "updated_status",
+    std::make_shared<traffic_simulator::CanonicalizedEntityStatus>(
+      canonicalizeInWorldFrame(traffic_simulator::social_force::makeUpdatedStatus(
+        *entity_status, target_speed.value(), other_entity_status, behavior_parameter,
+        step_time))));
+  return BT::NodeStatus::RUNNING;
+}
+}  // namespace pedestrian
+}  // namespace entity_behavior
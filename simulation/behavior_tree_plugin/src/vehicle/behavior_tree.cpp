@@ -33,24 +33,44 @@
 
 namespace entity_behavior
 {
+auto VehicleBehaviorTree::getBehaviorTreeID() -> const std::string &
+{
+  static const std::string id = "VehicleBehaviorTree";
+  return id;
+}
+
+auto VehicleBehaviorTree::getFactory() -> const std::shared_ptr<BT::BehaviorTreeFactory> &
+{
+  /**
+   * @note Registering the nodes and parsing the port annotated tree definition is done once per
+   * process. Each entity instantiates its own tree from the definition registered in the factory.
+   */
+  static const auto factory = []() {
+    auto factory = std::make_shared<BT::BehaviorTreeFactory>();
+    factory->registerNodeType<vehicle::follow_lane_sequence::FollowLaneAction>("FollowLane");
+    factory->registerNodeType<vehicle::follow_lane_sequence::FollowFrontEntityAction>(
+      "FollowFrontEntity");
+    factory->registerNodeType<vehicle::follow_lane_sequence::StopAtCrossingEntityAction>(
+      "StopAtCrossingEntity");
+    factory->registerNodeType<vehicle::follow_lane_sequence::StopAtStopLineAction>(
+      "StopAtStopLine");
+    factory->registerNodeType<vehicle::follow_lane_sequence::StopAtTrafficLightAction>(
+      "StopAtTrafficLight");
+    factory->registerNodeType<vehicle::follow_lane_sequence::YieldAction>("Yield");
+    factory->registerNodeType<vehicle::follow_lane_sequence::MoveBackwardAction>("MoveBackward");
+    factory->registerNodeType<vehicle::FollowPolylineTrajectoryAction>("FollowPolylineTrajectory");
+    factory->registerNodeType<vehicle::LaneChangeAction>("LaneChange");
+    registerBehaviorTree(
+      *factory, ament_index_cpp::get_package_share_directory("behavior_tree_plugin") +
+                  "/config/vehicle_entity_behavior.xml");
+    return factory;
+  }();
+  return factory;
+}
+
 void VehicleBehaviorTree::configure(const rclcpp::Logger & logger)
 {
-  factory_.registerNodeType<vehicle::follow_lane_sequence::FollowLaneAction>("FollowLane");
-  factory_.registerNodeType<vehicle::follow_lane_sequence::FollowFrontEntityAction>(
-    "FollowFrontEntity");
-  factory_.registerNodeType<vehicle::follow_lane_sequence::StopAtCrossingEntityAction>(
-    "StopAtCrossingEntity");
-  factory_.registerNodeType<vehicle::follow_lane_sequence::StopAtStopLineAction>("StopAtStopLine");
-  factory_.registerNodeType<vehicle::follow_lane_sequence::StopAtTrafficLightAction>(
-    "StopAtTrafficLight");
-  factory_.registerNodeType<vehicle::follow_lane_sequence::YieldAction>("Yield");
-  factory_.registerNodeType<vehicle::follow_lane_sequence::MoveBackwardAction>("MoveBackward");
-  factory_.registerNodeType<vehicle::FollowPolylineTrajectoryAction>("FollowPolylineTrajectory");
-  factory_.registerNodeType<vehicle::LaneChangeAction>("LaneChange");
-
-  tree_ = createBehaviorTree(
-    ament_index_cpp::get_package_share_directory("behavior_tree_plugin") +
-    "/config/vehicle_entity_behavior.xml");
+  tree_ = createBehaviorTree();
 
   logging_event_ptr_ =
     std::make_unique<behavior_tree_plugin::LoggingEvent>(tree_.rootNode(), logger);
@@ -62,7 +82,22 @@ void VehicleBehaviorTree::configure(const rclcpp::Logger & logger)
   setRequest(traffic_simulator::behavior::Request::NONE);
 }
 
-auto VehicleBehaviorTree::createBehaviorTree(const std::string & format_path) -> BT::Tree
+auto VehicleBehaviorTree::reset(const rclcpp::Logger & logger) -> bool
+{
+  /**
+   * @note Action nodes keep the state of the previous entity in their members, which halting the
+   * tree does not clear, so the tree is created again from the shared factory.
+   */
+  tree_.haltTree();
+  logging_event_ptr_.reset();
+  reset_request_event_ptr_.reset();
+  *context_ = ActionNodeContext();
+  configure(logger);
+  return true;
+}
+
+auto VehicleBehaviorTree::registerBehaviorTree(
+  BT::BehaviorTreeFactory & factory, const std::string & format_path) -> void
 {
   auto xml_doc = pugi::xml_document();
   xml_doc.load_file(format_path.c_str());
@@ -86,22 +121,32 @@ auto VehicleBehaviorTree::createBehaviorTree(const std::string & format_path) ->
     const BT::TreeNodeManifest & manifest_;
   };
 
-  for (const auto & [id, manifest] : factory_.manifests()) {
-    if (factory_.builtinNodes().count(id) == 0) {
+  for (const auto & [id, manifest] : factory.manifests()) {
+    if (factory.builtinNodes().count(id) == 0) {
       auto walker = XMLTreeWalker(manifest);
       xml_doc.traverse(walker);
     }
   }
 
+  auto behavior_tree = xml_doc.child("root").child("BehaviorTree");
+  behavior_tree.remove_attribute("ID");
+  behavior_tree.append_attribute("ID") = getBehaviorTreeID().c_str();
+
   auto xml_str = std::stringstream();
   xml_doc.save(xml_str);
-  return factory_.createTreeFromText(xml_str.str());
+  factory.registerBehaviorTreeFromText(xml_str.str());
+}
+
+auto VehicleBehaviorTree::createBehaviorTree() -> BT::Tree
+{
+  auto blackboard = BT::Blackboard::create();
+  blackboard->set(ActionNodeContext::key(), context_);
+  return factory_->createTree(getBehaviorTreeID(), blackboard);
 }
 
 auto VehicleBehaviorTree::getBehaviorParameter() -> traffic_simulator_msgs::msg::BehaviorParameter
 {
-  return tree_.rootBlackboard()->get<traffic_simulator_msgs::msg::BehaviorParameter>(
-    getBehaviorParameterKey());
+  return context_->behavior_parameter;
 }
 
 auto VehicleBehaviorTree::setBehaviorParameter(
@@ -133,8 +178,7 @@ auto VehicleBehaviorTree::setBehaviorParameter(
     return result;
   };
 
-  tree_.rootBlackboard()->set<traffic_simulator_msgs::msg::BehaviorParameter>(
-    getBehaviorParameterKey(), clamp(behavior_parameter));
+  context_->behavior_parameter = clamp(behavior_parameter);
 }
 
 const std::string & VehicleBehaviorTree::getCurrentAction() const
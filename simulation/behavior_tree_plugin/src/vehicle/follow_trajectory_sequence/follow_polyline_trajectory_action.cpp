@@ -23,8 +23,8 @@ auto FollowPolylineTrajectoryAction::calculateWaypoints()
 {
   auto waypoints = traffic_simulator_msgs::msg::WaypointsArray();
   waypoints.waypoints.push_back(entity_status->getMapPose().position);
-  for (const auto & vertex : polyline_trajectory->shape.vertices) {
-    waypoints.waypoints.push_back(vertex.position.position);
+  for (std::size_t i = 0; cursor and i < cursor->size(); ++i) {
+    waypoints.waypoints.push_back((*cursor)[i].position.position);
   }
   return waypoints;
 }
@@ -62,16 +62,21 @@ auto FollowPolylineTrajectoryAction::tick() -> BT::NodeStatus
       not getInput<decltype(target_speed)>("target_speed", target_speed) or
       not polyline_trajectory) {
     return BT::NodeStatus::FAILURE;
-  } else if (
+  }
+  if (not cursor or cursor->getPolylineTrajectory() != polyline_trajectory) {
+    cursor.emplace(polyline_trajectory);
+  }
+  if (
     const auto updated_status = traffic_simulator::follow_trajectory::makeUpdatedStatus(
-      static_cast<traffic_simulator::EntityStatus>(*entity_status), polyline_trajectory,
+      static_cast<traffic_simulator::EntityStatus>(*entity_status), cursor.value(),
       behavior_parameter, step_time)) {
     setOutput(
       "updated_status",
       std::make_shared<traffic_simulator::CanonicalizedEntityStatus>(
         traffic_simulator::CanonicalizedEntityStatus(*updated_status, hdmap_utils)));
-    setOutput("waypoints", calculateWaypoints());
-    setOutput("obstacle", calculateObstacle(calculateWaypoints()));
+    const auto waypoints = calculateWaypoints();
+    setOutput("waypoints", waypoints);
+    setOutput("obstacle", calculateObstacle(waypoints));
     return BT::NodeStatus::RUNNING;
   } else {
     return BT::NodeStatus::SUCCESS;
@@ -22,21 +22,15 @@
 namespace entity_behavior
 {
 VehicleActionNode::VehicleActionNode(const std::string & name, const BT::NodeConfiguration & config)
-: ActionNode(name, config)
+: ActionNode(name, config),
+  behavior_parameter(context->behavior_parameter),
+  vehicle_parameters(context->vehicle_parameters)
 {
 }
 
 void VehicleActionNode::getBlackBoardValues()
 {
   ActionNode::getBlackBoardValues();
-  if (!getInput<traffic_simulator_msgs::msg::BehaviorParameter>(
-        "behavior_parameter", behavior_parameter)) {
-    behavior_parameter = traffic_simulator_msgs::msg::BehaviorParameter();
-  }
-  if (!getInput<traffic_simulator_msgs::msg::VehicleParameters>(
-        "vehicle_parameters", vehicle_parameters)) {
-    THROW_SIMULATION_ERROR("failed to get input vehicle_parameters in VehicleActionNode");
-  }
   if (!getInput<std::shared_ptr<math::geometry::CatmullRomSpline>>(
         "reference_trajectory", reference_trajectory)) {
     THROW_SIMULATION_ERROR("failed to get input reference_trajectory in VehicleActionNode");
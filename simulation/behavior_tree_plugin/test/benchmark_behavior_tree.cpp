@@ -0,0 +1,160 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <behavior_tree_plugin/vehicle/behavior_tree.hpp>
+#include <memory>
+#include <random>
+#include <string>
+#include <traffic_simulator/behavior/tick_profiler.hpp>
+#include <traffic_simulator/data_type/entity_status_snapshot.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+#include <traffic_simulator/traffic_lights/traffic_light_manager.hpp>
+#include <vector>
+
+/**
+ * @note Ticks the vehicle behavior tree of every NPC once per iteration. The items_per_second
+ * counter is the number of NPC ticks per second. NPCs are placed on randomly chosen lanelets with
+ * a fixed seed, so results are comparable across releases.
+ */
+namespace
+{
+auto hdmapUtils() -> const std::shared_ptr<hdmap_utils::HdMapUtils> &
+{
+  static const auto hdmap_utils = []() {
+    geographic_msgs::msg::GeoPoint origin;
+    origin.latitude = 35.61836750154;
+    origin.longitude = 139.78066608243;
+    return std::make_shared<hdmap_utils::HdMapUtils>(
+      ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm",
+      origin);
+  }();
+  return hdmap_utils;
+}
+
+auto vehicleParameters() -> traffic_simulator_msgs::msg::VehicleParameters
+{
+  traffic_simulator_msgs::msg::VehicleParameters parameters;
+  parameters.name = "vehicle";
+  parameters.subtype.value = traffic_simulator_msgs::msg::EntitySubtype::CAR;
+  parameters.performance.max_speed = 69.444;
+  parameters.performance.max_acceleration = 200;
+  parameters.performance.max_deceleration = 10.0;
+  parameters.bounding_box.center.x = 1.5;
+  parameters.bounding_box.center.z = 0.9;
+  parameters.bounding_box.dimensions.x = 4.5;
+  parameters.bounding_box.dimensions.y = 2.1;
+  parameters.bounding_box.dimensions.z = 1.8;
+  parameters.axles.front_axle.max_steering = 0.5;
+  parameters.axles.front_axle.wheel_diameter = 0.6;
+  parameters.axles.front_axle.track_width = 1.8;
+  parameters.axles.front_axle.position_x = 3.1;
+  parameters.axles.front_axle.position_z = 0.3;
+  parameters.axles.rear_axle.wheel_diameter = 0.6;
+  parameters.axles.rear_axle.track_width = 1.8;
+  parameters.axles.rear_axle.position_z = 0.3;
+  return parameters;
+}
+
+struct Npc
+{
+  std::shared_ptr<entity_behavior::VehicleBehaviorTree> behavior_tree;
+
+  traffic_simulator::EntityStatus status;
+};
+
+auto makeNpcs(std::size_t number_of_npcs) -> std::vector<Npc>
+{
+  const auto & hdmap_utils = hdmapUtils();
+  const auto parameters = vehicleParameters();
+  const auto traffic_light_manager =
+    std::make_shared<traffic_simulator::TrafficLightManager>(hdmap_utils);
+
+  std::mt19937 engine(0);
+  const auto lanelet_ids = hdmap_utils->getLaneletIds();
+  std::uniform_int_distribution<std::size_t> lanelet_index(0, lanelet_ids.size() - 1);
+  std::uniform_real_distribution<double> ratio(0.0, 1.0);
+
+  std::vector<Npc> npcs(number_of_npcs);
+  auto snapshot = std::make_shared<traffic_simulator::EntityStatusSnapshot>();
+  entity_behavior::EntityTypeDict entity_types;
+  for (std::size_t i = 0; i < number_of_npcs; ++i) {
+    auto & status = npcs[i].status;
+    const auto lanelet_id = lanelet_ids[lanelet_index(engine)];
+    status.name = "npc" + std::to_string(i);
+    status.type.type = traffic_simulator_msgs::msg::EntityType::VEHICLE;
+    status.subtype = parameters.subtype;
+    status.bounding_box = parameters.bounding_box;
+    status.lanelet_pose = traffic_simulator::helper::constructLaneletPose(
+      lanelet_id, ratio(engine) * hdmap_utils->getLaneletLength(lanelet_id), 0.0);
+    status.lanelet_pose_valid = true;
+    status.pose = hdmap_utils->toMapPose(status.lanelet_pose).pose;
+    status.action_status.twist.linear.x = 10.0;
+    snapshot->emplace(
+      status.name, traffic_simulator::CanonicalizedEntityStatus(status, hdmap_utils));
+    entity_types.emplace(status.name, status.type);
+  }
+
+  for (auto & npc : npcs) {
+    const auto route_lanelets =
+      hdmap_utils->getFollowingLanelets(npc.status.lanelet_pose.lanelet_id);
+    npc.behavior_tree = std::make_shared<entity_behavior::VehicleBehaviorTree>();
+    npc.behavior_tree->configure(rclcpp::get_logger(npc.status.name));
+    npc.behavior_tree->setVehicleParameters(parameters);
+    npc.behavior_tree->setDebugMarker({});
+    npc.behavior_tree->setBehaviorParameter(traffic_simulator_msgs::msg::BehaviorParameter());
+    npc.behavior_tree->setHdMapUtils(hdmap_utils);
+    npc.behavior_tree->setTrafficLightManager(traffic_light_manager);
+    npc.behavior_tree->setOtherEntityStatus(
+      traffic_simulator::OtherEntityStatusView(snapshot, npc.status.name));
+    npc.behavior_tree->setEntityTypeList(entity_types);
+    npc.behavior_tree->setTargetSpeed(std::nullopt);
+    npc.behavior_tree->setRouteLanelets(route_lanelets);
+    npc.behavior_tree->setReferenceTrajectory(
+      std::make_shared<math::geometry::CatmullRomSpline>(
+        hdmap_utils->getCenterPoints(route_lanelets)));
+  }
+  return npcs;
+}
+}  // namespace
+
+static void TickVehicleBehaviorTrees(benchmark::State & state)
+{
+  auto npcs = makeNpcs(state.range(0));
+  constexpr double step_time = 0.05;
+  double current_time = 0.0;
+  for (auto _ : state) {
+    for (auto & npc : npcs) {
+      npc.behavior_tree->setEntityStatus(
+        std::make_shared<traffic_simulator::CanonicalizedEntityStatus>(npc.status, hdmapUtils()));
+      npc.behavior_tree->update(current_time, step_time);
+    }
+    current_time += step_time;
+  }
+  state.SetItemsProcessed(state.iterations() * npcs.size());
+}
+BENCHMARK(TickVehicleBehaviorTrees)->Arg(100)->Arg(300)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+/// @note Same as TickVehicleBehaviorTrees with the tick profiler enabled, to measure its overhead.
+static void TickVehicleBehaviorTreesWithProfiler(benchmark::State & state)
+{
+  traffic_simulator::behavior::TickProfiler::get().enable();
+  TickVehicleBehaviorTrees(state);
+  traffic_simulator::behavior::TickProfiler::get().enable(false);
+}
+BENCHMARK(TickVehicleBehaviorTreesWithProfiler)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
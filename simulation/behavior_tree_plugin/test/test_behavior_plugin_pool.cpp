@@ -0,0 +1,186 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <memory>
+#include <rclcpp/rclcpp.hpp>
+#include <string>
+#include <traffic_simulator/behavior/behavior_plugin_pool.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+#include <traffic_simulator/traffic_lights/traffic_light_manager.hpp>
+
+const std::string vehicle_behavior_tree = "behavior_tree_plugin/VehicleBehaviorTree";
+
+const std::string pedestrian_behavior_tree = "behavior_tree_plugin/PedestrianBehaviorTree";
+
+TEST(BehaviorPluginPool, ReleasedPluginIsReacquired)
+{
+  const auto pool = std::make_shared<traffic_simulator::BehaviorPluginPool>();
+  const auto logger = rclcpp::get_logger("ReleasedPluginIsReacquired");
+  auto plugin = pool->acquire(vehicle_behavior_tree, logger);
+  const auto another_plugin = pool->acquire(vehicle_behavior_tree, logger);
+  const auto pointer = plugin.get();
+  EXPECT_NE(pointer, another_plugin.get());
+  EXPECT_EQ(pool->size(vehicle_behavior_tree), 0U);
+  plugin.reset();
+  EXPECT_EQ(pool->size(vehicle_behavior_tree), 1U);
+  const auto reacquired_plugin = pool->acquire(vehicle_behavior_tree, logger);
+  EXPECT_EQ(reacquired_plugin.get(), pointer);
+  EXPECT_EQ(pool->size(vehicle_behavior_tree), 0U);
+}
+
+/// @note A reused plugin holds nothing of its previous entity, like a newly loaded one.
+TEST(BehaviorPluginPool, ReacquiredPluginIsReset)
+{
+  const auto pool = std::make_shared<traffic_simulator::BehaviorPluginPool>();
+  const auto logger = rclcpp::get_logger("ReacquiredPluginIsReset");
+  const auto new_plugin = std::make_shared<traffic_simulator::BehaviorPluginPool>()->acquire(
+    vehicle_behavior_tree, logger);
+  auto plugin = pool->acquire(vehicle_behavior_tree, logger);
+  plugin->setRequest(traffic_simulator::behavior::Request::LANE_CHANGE);
+  plugin->setTargetSpeed(10.0);
+  plugin->setGoalPoses({geometry_msgs::msg::Pose()});
+  plugin->setRouteLanelets({34513, 34510});
+  plugin.reset();
+
+  plugin = pool->acquire(vehicle_behavior_tree, logger);
+  EXPECT_EQ(plugin->getRequest(), traffic_simulator::behavior::Request::NONE);
+  /// @note Entries of the cleared blackboard are missing until the entity sets them again.
+  EXPECT_THROW(plugin->getTargetSpeed(), std::exception);
+  EXPECT_THROW(new_plugin->getTargetSpeed(), std::exception);
+  EXPECT_THROW(plugin->getGoalPoses(), std::exception);
+  EXPECT_TRUE(plugin->getRouteLanelets().empty());
+  EXPECT_EQ(plugin->getCurrentAction(), new_plugin->getCurrentAction());
+}
+
+TEST(BehaviorPluginPool, PluginsArePooledByName)
+{
+  const auto pool = std::make_shared<traffic_simulator::BehaviorPluginPool>();
+  const auto logger = rclcpp::get_logger("PluginsArePooledByName");
+  auto vehicle_plugin = pool->acquire(vehicle_behavior_tree, logger);
+  const auto vehicle_pointer = vehicle_plugin.get();
+  vehicle_plugin.reset();
+  EXPECT_EQ(pool->size(vehicle_behavior_tree), 1U);
+  EXPECT_EQ(pool->size(pedestrian_behavior_tree), 0U);
+
+  const auto pedestrian_plugin = pool->acquire(pedestrian_behavior_tree, logger);
+  EXPECT_NE(pedestrian_plugin.get(), vehicle_pointer);
+  EXPECT_EQ(pool->size(vehicle_behavior_tree), 1U);
+  EXPECT_EQ(pool->size(pedestrian_behavior_tree), 0U);
+}
+
+auto getHdMapUtils() -> const std::shared_ptr<hdmap_utils::HdMapUtils> &
+{
+  static const auto hdmap_utils = []() {
+    geographic_msgs::msg::GeoPoint origin;
+    origin.latitude = 35.61836750154;
+    origin.longitude = 139.78066608243;
+    return std::make_shared<hdmap_utils::HdMapUtils>(
+      ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm",
+      origin);
+  }();
+  return hdmap_utils;
+}
+
+auto getVehicleParameters() -> traffic_simulator_msgs::msg::VehicleParameters
+{
+  traffic_simulator_msgs::msg::VehicleParameters parameters;
+  parameters.subtype.value = traffic_simulator_msgs::msg::EntitySubtype::CAR;
+  parameters.performance.max_speed = 69.444;
+  parameters.performance.max_acceleration = 200;
+  parameters.performance.max_deceleration = 10.0;
+  parameters.bounding_box.center.x = 1.5;
+  parameters.bounding_box.dimensions.x = 4.5;
+  parameters.bounding_box.dimensions.y = 2.1;
+  parameters.bounding_box.dimensions.z = 1.8;
+  return parameters;
+}
+
+/// @note Set up the plugin as VehicleEntity does for a vehicle on lanelet 34675, and tick it once.
+auto tick(entity_behavior::BehaviorPluginBase & plugin, double s, double speed)
+  -> traffic_simulator::EntityStatus
+{
+  const auto & hdmap_utils = getHdMapUtils();
+  const auto parameters = getVehicleParameters();
+  plugin.setVehicleParameters(parameters);
+  plugin.setDebugMarker({});
+  plugin.setBehaviorParameter(traffic_simulator_msgs::msg::BehaviorParameter());
+  plugin.setHdMapUtils(hdmap_utils);
+  plugin.setTrafficLightManager(
+    std::make_shared<traffic_simulator::TrafficLightManager>(hdmap_utils));
+  plugin.setRequest(traffic_simulator::behavior::Request::NONE);
+  plugin.setGoalPoses({});
+  plugin.setPolylineTrajectory(nullptr);
+  plugin.setLaneChangeParameters(traffic_simulator::lane_change::Parameter());
+  plugin.setOtherEntityStatus(entity_behavior::EntityStatusDict());
+  plugin.setEntityTypeList({});
+
+  traffic_simulator::EntityStatus status;
+  status.name = "vehicle";
+  status.type.type = traffic_simulator_msgs::msg::EntityType::VEHICLE;
+  status.bounding_box = parameters.bounding_box;
+  status.action_status.twist.linear.x = speed;
+  status.lanelet_pose = traffic_simulator::helper::constructLaneletPose(34675, s, 0.0);
+  status.lanelet_pose_valid = true;
+  status.pose = hdmap_utils->toMapPose(status.lanelet_pose).pose;
+  plugin.setEntityStatus(
+    std::make_shared<traffic_simulator::CanonicalizedEntityStatus>(status, hdmap_utils));
+  plugin.setTargetSpeed(10.0);
+  const auto route_lanelets = hdmap_utils->getFollowingLanelets(34675);
+  plugin.setRouteLanelets(route_lanelets);
+  plugin.setReferenceTrajectory(std::make_shared<math::geometry::CatmullRomSpline>(
+    hdmap_utils->getCenterPoints(route_lanelets)));
+  plugin.update(0.0, 0.1);
+  return static_cast<traffic_simulator::EntityStatus>(*plugin.getUpdatedStatus());
+}
+
+/**
+ * @note A reused plugin drives like a newly loaded one. The previous vehicle stops right before the
+ * stop line of lanelet 34675, which StopAtStopLineAction remembers, and the next one approaches it.
+ */
+TEST(BehaviorPluginPool, ReacquiredPluginTicksLikeNewPlugin)
+{
+  const auto & hdmap_utils = getHdMapUtils();
+  const auto stop_line_distance = hdmap_utils->getDistanceToStopLine(
+    {34675}, math::geometry::CatmullRomSpline(hdmap_utils->getCenterPoints(34675)));
+  ASSERT_TRUE(stop_line_distance);
+
+  const auto pool = std::make_shared<traffic_simulator::BehaviorPluginPool>();
+  const auto logger = rclcpp::get_logger("ReacquiredPluginTicksLikeNewPlugin");
+  auto plugin = pool->acquire(vehicle_behavior_tree, logger);
+  tick(*plugin, stop_line_distance.value() - 3.0, 0.0);
+  tick(*plugin, stop_line_distance.value() - 3.0, 0.0);
+  const auto pointer = plugin.get();
+  plugin.reset();
+  plugin = pool->acquire(vehicle_behavior_tree, logger);
+  ASSERT_EQ(plugin.get(), pointer);
+
+  const auto new_plugin = std::make_shared<traffic_simulator::BehaviorPluginPool>()->acquire(
+    vehicle_behavior_tree, logger);
+  const auto expected = tick(*new_plugin, 0.0, 8.0);
+  const auto actual = tick(*plugin, 0.0, 8.0);
+  EXPECT_EQ(plugin->getCurrentAction(), new_plugin->getCurrentAction());
+  EXPECT_DOUBLE_EQ(actual.action_status.twist.linear.x, expected.action_status.twist.linear.x);
+  EXPECT_DOUBLE_EQ(actual.lanelet_pose.s, expected.lanelet_pose.s);
+  EXPECT_DOUBLE_EQ(actual.pose.position.x, expected.pose.position.x);
+  EXPECT_DOUBLE_EQ(actual.pose.position.y, expected.pose.position.y);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
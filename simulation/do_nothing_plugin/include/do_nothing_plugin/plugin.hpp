@@ -33,6 +33,12 @@ public:
    * @param logger logger for debug output, this argument exists for other BehaviorPlugin classes but are not used by this plugin.
    */
   void configure(const rclcpp::Logger & logger) override;
+  /**
+   * @brief Clear stored values so that this plugin can be reused by another entity.
+   * @param logger logger for debug output, this argument exists for other BehaviorPlugin classes but are not used by this plugin.
+   * @return always return true
+   */
+  auto reset(const rclcpp::Logger & logger) -> bool override;
   /**
    * @brief Get the Current Action object
    * @return const std::string& always return "do_nothing"
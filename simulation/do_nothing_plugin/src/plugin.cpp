@@ -18,6 +18,16 @@ namespace entity_behavior
 {
 void DoNothingBehavior::configure(const rclcpp::Logger &) {}
 
+auto DoNothingBehavior::reset(const rclcpp::Logger &) -> bool
+{
+  current_time_ = 0.0;
+  step_time_ = 0.0;
+  entity_status_ = nullptr;
+  behavior_parameter_ = traffic_simulator_msgs::msg::BehaviorParameter();
+  updated_status_ = nullptr;
+  return true;
+}
+
 void DoNothingBehavior::update(double current_time, double)
 {
   entity_status_->setTime(current_time);
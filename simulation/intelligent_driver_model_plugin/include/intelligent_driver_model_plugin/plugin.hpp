@@ -0,0 +1,124 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef INTELLIGENT_DRIVER_MODEL_PLUGIN__PLUGIN_HPP_
+#define INTELLIGENT_DRIVER_MODEL_PLUGIN__PLUGIN_HPP_
+
+#include <string>
+#include <traffic_simulator/behavior/behavior_plugin_base.hpp>
+#include <traffic_simulator/behavior/intelligent_driver_model.hpp>
+
+namespace entity_behavior
+{
+/**
+ * @brief Lightweight vehicle behavior for background traffic.
+ * The vehicle follows its route lanelets with the intelligent driver model, and changes to a
+ * neighbouring lane when MOBIL finds it beneficial and safe. It does not stop at stop lines or
+ * traffic lights, does not yield at intersections and ignores lane change and polyline trajectory
+ * requests, so use behavior_tree_plugin for vehicles which have to follow traffic rules.
+ */
+class IntelligentDriverModelBehavior : public BehaviorPluginBase
+{
+public:
+  /**
+   * @brief Update the speed and the lanelet pose of the vehicle from its leader on its lane.
+   * @param current_time current time in scenario time
+   * @param step_time step time of the simulation
+   */
+  void update(double current_time, double step_time) override;
+  /**
+   * @brief setup rclcpp::logger for debug output, but there is no debug output in this plugin.
+   * @param logger logger for debug output, this argument exists for other BehaviorPlugin classes but are not used by this plugin.
+   */
+  void configure(const rclcpp::Logger & logger) override;
+  /**
+   * @brief Clear stored values so that this plugin can be reused by another entity.
+   * @param logger logger for debug output, this argument exists for other BehaviorPlugin classes but are not used by this plugin.
+   * @return always return true
+   */
+  auto reset(const rclcpp::Logger & logger) -> bool override;
+  /**
+   * @brief Get the Current Action object
+   * @return const std::string& "lane_change" while moving to the centerline after a lane change, "follow_lane" otherwise.
+   */
+  const std::string & getCurrentAction() const override;
+  /**
+   * @brief Calculate waypoints along the reference trajectory from the last entity status.
+   * @return empty waypoints if the vehicle is not on a lane or there is no reference trajectory.
+   */
+  auto getWaypoints() -> traffic_simulator_msgs::msg::WaypointsArray override;
+  void setWaypoints(const traffic_simulator_msgs::msg::WaypointsArray &) override{};
+
+private:
+  /// @note Lanelet pose of the vehicle, the lanelets it follows and its neighbours on them.
+  struct LanePosition
+  {
+    traffic_simulator::LaneletPose lanelet_pose;
+    std::vector<std::int64_t> route_lanelets;
+    traffic_simulator::intelligent_driver_model::Neighbours neighbours;
+  };
+
+  auto getDesiredSpeed(const std::vector<std::int64_t> & route_lanelets) const -> double;
+
+  /// @note Position on the neighbouring lane chosen by MOBIL, if changing lanes is beneficial.
+  auto findLaneChange(const LanePosition & current, double speed, double desired_speed) const
+    -> std::optional<LanePosition>;
+
+  traffic_simulator::intelligent_driver_model::Parameter parameter_;
+  std::string current_action_ = "follow_lane";
+
+/// @note Getters defined by this macro return default values and setters are behaved as no-operation functions.
+#define DEFINE_GETTER_SETTER(NAME, TYPE)        \
+public:                                         \
+  TYPE get##NAME() override { return TYPE(); }; \
+  void set##NAME(const TYPE &) override{};
+  // clang-format off
+  DEFINE_GETTER_SETTER(DebugMarker,          std::vector<visualization_msgs::msg::Marker>)
+  DEFINE_GETTER_SETTER(EntityTypeList,       EntityTypeDict)
+  DEFINE_GETTER_SETTER(PolylineTrajectory,   std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory>)
+  DEFINE_GETTER_SETTER(LaneChangeParameters, traffic_simulator::lane_change::Parameter)
+  DEFINE_GETTER_SETTER(PedestrianParameters, traffic_simulator_msgs::msg::PedestrianParameters)
+  DEFINE_GETTER_SETTER(TrafficLightManager,  std::shared_ptr<traffic_simulator::TrafficLightManager>)
+  DEFINE_GETTER_SETTER(VehicleParameters,    traffic_simulator_msgs::msg::VehicleParameters)
+  // clang-format on
+#undef DEFINE_GETTER_SETTER
+
+/// @note Getters defined by this macro return stored values and setters store values.
+#define DEFINE_GETTER_SETTER(NAME, TYPE, FIELD_NAME)                   \
+public:                                                                \
+  TYPE get##NAME() override { return FIELD_NAME; };                    \
+  void set##NAME(const TYPE & value) override { FIELD_NAME = value; }; \
+                                                                       \
+private:                                                               \
+  TYPE FIELD_NAME;
+  // clang-format off
+  DEFINE_GETTER_SETTER(CurrentTime,         double,                                                        current_time_)
+  DEFINE_GETTER_SETTER(StepTime,            double,                                                        step_time_)
+  DEFINE_GETTER_SETTER(EntityStatus,        std::shared_ptr<traffic_simulator::CanonicalizedEntityStatus>, entity_status_)
+  DEFINE_GETTER_SETTER(BehaviorParameter,   traffic_simulator_msgs::msg::BehaviorParameter,                behavior_parameter_)
+  DEFINE_GETTER_SETTER(GoalPoses,           std::vector<geometry_msgs::msg::Pose>,                         goal_poses_)
+  DEFINE_GETTER_SETTER(HdMapUtils,          std::shared_ptr<hdmap_utils::HdMapUtils>,                      hdmap_utils_)
+  DEFINE_GETTER_SETTER(Obstacle,            std::optional<traffic_simulator_msgs::msg::Obstacle>,          obstacle_)
+  DEFINE_GETTER_SETTER(OtherEntityStatus,   EntityStatusDict,                                              other_entity_status_)
+  DEFINE_GETTER_SETTER(ReferenceTrajectory, std::shared_ptr<math::geometry::CatmullRomSpline>,             reference_trajectory_)
+  DEFINE_GETTER_SETTER(Request,             traffic_simulator::behavior::Request,                          request_)
+  DEFINE_GETTER_SETTER(RouteLanelets,       std::vector<std::int64_t>,                                     route_lanelets_)
+  DEFINE_GETTER_SETTER(TargetSpeed,         std::optional<double>,                                         target_speed_)
+  DEFINE_GETTER_SETTER(UpdatedStatus,       std::shared_ptr<traffic_simulator::CanonicalizedEntityStatus>, updated_status_)
+  // clang-format on
+#undef DEFINE_GETTER_SETTER
+};
+}  // namespace entity_behavior
+
+#endif  // INTELLIGENT_DRIVER_MODEL_PLUGIN__PLUGIN_HPP_
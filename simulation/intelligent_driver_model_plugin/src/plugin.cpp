@@ -0,0 +1,237 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <intelligent_driver_model_plugin/plugin.hpp>
+#include <scenario_simulator_exception/exception.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+
+namespace entity_behavior
+{
+namespace idm = traffic_simulator::intelligent_driver_model;
+
+namespace
+{
+/// @note Same as the horizon of behavior_tree_plugin.
+auto getHorizon(double speed) { return std::clamp(speed * 5.0, 20.0, 50.0); }
+
+/// @note The vehicle is regarded as on the centerline of its lane within this offset [m].
+constexpr auto centerline_tolerance = 0.1;
+
+/// @note Maximum distance between the vehicle and the centerline of the lane it changes to [m].
+constexpr auto lane_change_matching_distance = 5.0;
+}  // namespace
+
+void IntelligentDriverModelBehavior::configure(const rclcpp::Logger &) {}
+
+auto IntelligentDriverModelBehavior::reset(const rclcpp::Logger &) -> bool
+{
+  current_action_ = "follow_lane";
+  current_time_ = 0.0;
+  step_time_ = 0.0;
+  entity_status_ = nullptr;
+  behavior_parameter_ = traffic_simulator_msgs::msg::BehaviorParameter();
+  goal_poses_.clear();
+  hdmap_utils_ = nullptr;
+  obstacle_ = std::nullopt;
+  other_entity_status_ = EntityStatusDict();
+  reference_trajectory_ = nullptr;
+  request_ = traffic_simulator::behavior::Request::NONE;
+  route_lanelets_.clear();
+  target_speed_ = std::nullopt;
+  updated_status_ = nullptr;
+  return true;
+}
+
+auto IntelligentDriverModelBehavior::getDesiredSpeed(
+  const std::vector<std::int64_t> & route_lanelets) const -> double
+{
+  return std::min(
+    target_speed_ ? target_speed_.value() : hdmap_utils_->getSpeedLimit(route_lanelets),
+    behavior_parameter_.dynamic_constraints.max_speed);
+}
+
+auto IntelligentDriverModelBehavior::findLaneChange(
+  const LanePosition & current, double speed, double desired_speed) const
+  -> std::optional<LanePosition>
+{
+  /// @note Lane changes would leave the route to the goal, and are not started during another one.
+  if (
+    not behavior_parameter_.see_around or not goal_poses_.empty() or
+    std::abs(current.lanelet_pose.offset) > centerline_tolerance) {
+    return std::nullopt;
+  }
+  const auto bounding_box = entity_status_->getBoundingBox();
+  const auto lanelet_length = hdmap_utils_->getLaneletLength(current.lanelet_pose.lanelet_id);
+  std::optional<double> maximum_incentive;
+  std::optional<LanePosition> target;
+  for (const auto direction :
+       {traffic_simulator::lane_change::Direction::LEFT,
+        traffic_simulator::lane_change::Direction::RIGHT}) {
+    const auto lanelet_id =
+      hdmap_utils_->getLaneChangeableLaneletId(current.lanelet_pose.lanelet_id, direction);
+    if (not lanelet_id) {
+      continue;
+    }
+    /**
+     * @note Neighbouring lanelets cover the same part of the road, so s on the neighbouring lanelet
+     * is estimated from the lanelet lengths. The pose is only projected onto the chosen lanelet.
+     */
+    const auto s =
+      current.lanelet_pose.s * hdmap_utils_->getLaneletLength(lanelet_id.value()) / lanelet_length;
+    auto route_lanelets = hdmap_utils_->getFollowingLanelets(lanelet_id.value());
+    const auto neighbours = idm::findNeighbours(
+      other_entity_status_, idm::makeLane(*hdmap_utils_, route_lanelets, parameter_), s,
+      bounding_box);
+    if (const auto incentive = idm::calculateLaneChangeIncentive(
+          speed, desired_speed, bounding_box.dimensions.x, current.neighbours, neighbours,
+          parameter_);
+        incentive and incentive.value() > parameter_.lane_change_threshold and
+        (not maximum_incentive or incentive.value() > maximum_incentive.value())) {
+      maximum_incentive = incentive;
+      target = LanePosition{
+        traffic_simulator::helper::constructLaneletPose(lanelet_id.value(), s, 0.0),
+        std::move(route_lanelets), neighbours};
+    }
+  }
+  if (target) {
+    if (const auto lanelet_pose = hdmap_utils_->toLaneletPose(
+          entity_status_->getMapPose(), target->lanelet_pose.lanelet_id,
+          lane_change_matching_distance)) {
+      target->lanelet_pose = lanelet_pose.value();
+      return target;
+    }
+  }
+  return std::nullopt;
+}
+
+void IntelligentDriverModelBehavior::update(double current_time, double step_time)
+{
+  auto updated_status = static_cast<traffic_simulator::EntityStatus>(*entity_status_);
+  updated_status.time = current_time + step_time;
+  current_action_ = "follow_lane";
+  obstacle_ = std::nullopt;
+
+  if (step_time <= 0.0) {
+    /// @note Nothing moves in no time, and the acceleration and the jerk can not be calculated.
+    updated_status_ =
+      std::make_shared<traffic_simulator::CanonicalizedEntityStatus>(updated_status, hdmap_utils_);
+    return;
+  }
+
+  if (not entity_status_->laneMatchingSucceed()) {
+    /// @note This model only drives along lanes, so a vehicle off the lanes stops where it is.
+    updated_status.action_status.twist = geometry_msgs::msg::Twist();
+    updated_status.action_status.accel = geometry_msgs::msg::Accel();
+    updated_status.action_status.linear_jerk = 0.0;
+    updated_status_ =
+      std::make_shared<traffic_simulator::CanonicalizedEntityStatus>(updated_status, hdmap_utils_);
+    return;
+  }
+
+  auto position = LanePosition{entity_status_->getLaneletPose(), route_lanelets_, {}};
+  if (
+    position.route_lanelets.empty() or
+    position.route_lanelets.front() != position.lanelet_pose.lanelet_id) {
+    position.route_lanelets = hdmap_utils_->getFollowingLanelets(position.lanelet_pose.lanelet_id);
+  }
+  const auto speed = entity_status_->getTwist().linear.x;
+  const auto desired_speed = getDesiredSpeed(position.route_lanelets);
+  if (behavior_parameter_.see_around) {
+    position.neighbours = idm::findNeighbours(
+      other_entity_status_, idm::makeLane(*hdmap_utils_, position.route_lanelets, parameter_),
+      position.lanelet_pose.s, entity_status_->getBoundingBox());
+  }
+  if (auto lane_change = findLaneChange(position, speed, desired_speed)) {
+    position = std::move(lane_change.value());
+  }
+
+  const auto & constraints = behavior_parameter_.dynamic_constraints;
+  const auto acceleration = std::clamp(
+    idm::calculateAcceleration(speed, desired_speed, position.neighbours.leader, parameter_),
+    -constraints.max_deceleration, constraints.max_acceleration);
+  const auto updated_speed =
+    std::min(std::max(speed + acceleration * step_time, 0.0), constraints.max_speed);
+
+  /// @note The vehicle moves towards the centerline of its lane and heads in its moving direction.
+  auto lanelet_pose = position.lanelet_pose;
+  const auto lateral_speed =
+    -std::copysign(
+      std::min(std::abs(lanelet_pose.offset), parameter_.lateral_speed * step_time),
+      lanelet_pose.offset) /
+    step_time;
+  lanelet_pose.s += (speed + updated_speed) / 2.0 * step_time;
+  lanelet_pose.offset += lateral_speed * step_time;
+  lanelet_pose.rpy = geometry_msgs::msg::Vector3();
+  lanelet_pose.rpy.z = std::atan2(lateral_speed, updated_speed);
+  if (std::abs(lanelet_pose.offset) > centerline_tolerance) {
+    current_action_ = "lane_change";
+  }
+
+  if (const auto [canonicalized_lanelet_pose, end_of_road_lanelet_id] =
+        hdmap_utils_->canonicalizeLaneletPose(lanelet_pose, position.route_lanelets);
+      canonicalized_lanelet_pose) {
+    lanelet_pose = canonicalized_lanelet_pose.value();
+  } else if (end_of_road_lanelet_id) {
+    lanelet_pose.lanelet_id = end_of_road_lanelet_id.value();
+    lanelet_pose.s =
+      lanelet_pose.s < 0 ? 0.0 : hdmap_utils_->getLaneletLength(end_of_road_lanelet_id.value());
+  } else {
+    THROW_SIMULATION_ERROR("Failed to find trailing lanelet_id.");
+  }
+
+  updated_status.lanelet_pose = lanelet_pose;
+  updated_status.lanelet_pose_valid = true;
+  updated_status.pose = hdmap_utils_->toMapPose(lanelet_pose).pose;
+  updated_status.action_status.twist = geometry_msgs::msg::Twist();
+  updated_status.action_status.twist.linear.x = updated_speed;
+  updated_status.action_status.accel = geometry_msgs::msg::Accel();
+  updated_status.action_status.accel.linear.x = (updated_speed - speed) / step_time;
+  updated_status.action_status.linear_jerk =
+    (updated_status.action_status.accel.linear.x - entity_status_->getAccel().linear.x) / step_time;
+  updated_status_ =
+    std::make_shared<traffic_simulator::CanonicalizedEntityStatus>(updated_status, hdmap_utils_);
+
+  if (const auto & leader = position.neighbours.leader;
+      leader and leader->gap < getHorizon(updated_speed)) {
+    traffic_simulator_msgs::msg::Obstacle obstacle;
+    obstacle.type = traffic_simulator_msgs::msg::Obstacle::ENTITY;
+    obstacle.s = leader->gap;
+    obstacle_ = obstacle;
+  }
+}
+
+auto IntelligentDriverModelBehavior::getWaypoints() -> traffic_simulator_msgs::msg::WaypointsArray
+{
+  traffic_simulator_msgs::msg::WaypointsArray waypoints;
+  if (entity_status_ and entity_status_->laneMatchingSucceed() and reference_trajectory_) {
+    const auto lanelet_pose = entity_status_->getLaneletPose();
+    waypoints.waypoints = reference_trajectory_->getTrajectory(
+      lanelet_pose.s, lanelet_pose.s + getHorizon(entity_status_->getTwist().linear.x), 1.0,
+      lanelet_pose.offset);
+  }
+  return waypoints;
+}
+
+const std::string & IntelligentDriverModelBehavior::getCurrentAction() const
+{
+  return current_action_;
+}
+}  // namespace entity_behavior
+
+#include "pluginlib/class_list_macros.hpp"
+
+PLUGINLIB_EXPORT_CLASS(
+  entity_behavior::IntelligentDriverModelBehavior, entity_behavior::BehaviorPluginBase)
@@ -0,0 +1,162 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <cmath>
+#include <intelligent_driver_model_plugin/plugin.hpp>
+#include <memory>
+#include <string>
+#include <traffic_simulator/helper/helper.hpp>
+
+namespace idm = traffic_simulator::intelligent_driver_model;
+
+/**
+ * @note On the kashiwanoha map, lanelet 34513 is the left neighbour of lanelet 34462 in the same
+ * direction and lanelet 34462 has no right neighbour, which the lanechange_left mock also uses.
+ */
+class IntelligentDriverModelPlugin : public testing::Test
+{
+protected:
+  IntelligentDriverModelPlugin()
+  : hdmap_utils(std::make_shared<hdmap_utils::HdMapUtils>(
+      ament_index_cpp::get_package_share_directory("kashiwanoha_map") + "/map/lanelet2_map.osm",
+      geographic_msgs::msg::GeoPoint())),
+    snapshot(std::make_shared<traffic_simulator::EntityStatusSnapshot>())
+  {
+    plugin.configure(rclcpp::get_logger("test_plugin"));
+    plugin.setHdMapUtils(hdmap_utils);
+    plugin.setBehaviorParameter(traffic_simulator_msgs::msg::BehaviorParameter());
+    plugin.setTargetSpeed(10.0);
+  }
+
+  auto makeEntityStatus(const std::string & name, std::int64_t lanelet_id, double s, double speed)
+    -> traffic_simulator::CanonicalizedEntityStatus
+  {
+    traffic_simulator::EntityStatus status;
+    status.name = name;
+    status.bounding_box.dimensions.x = 4.0;
+    status.bounding_box.dimensions.y = 2.0;
+    status.action_status.twist.linear.x = speed;
+    status.lanelet_pose = traffic_simulator::helper::constructLaneletPose(lanelet_id, s, 0.0);
+    status.lanelet_pose_valid = true;
+    status.pose = hdmap_utils->toMapPose(status.lanelet_pose).pose;
+    return traffic_simulator::CanonicalizedEntityStatus(status, hdmap_utils);
+  }
+
+  /// @note Spawn the vehicle driven by the plugin, the other entities have to be emplaced before.
+  auto setEgo(std::int64_t lanelet_id, double s, double speed) -> void
+  {
+    snapshot->emplace("ego", makeEntityStatus("ego", lanelet_id, s, speed));
+    plugin.setEntityStatus(
+      std::make_shared<traffic_simulator::CanonicalizedEntityStatus>(snapshot->at("ego")));
+    plugin.setOtherEntityStatus(traffic_simulator::OtherEntityStatusView(snapshot, "ego"));
+  }
+
+  const std::shared_ptr<hdmap_utils::HdMapUtils> hdmap_utils;
+  const std::shared_ptr<traffic_simulator::EntityStatusSnapshot> snapshot;
+  entity_behavior::IntelligentDriverModelBehavior plugin;
+};
+
+/// @note A vehicle blocked beside the ego prevents the lane change, so the ego follows its leader.
+TEST_F(IntelligentDriverModelPlugin, FollowLeader)
+{
+  snapshot->emplace("leader", makeEntityStatus("leader", 34462, 22.0, 4.0));
+  snapshot->emplace("blocker", makeEntityStatus("blocker", 34513, 10.0, 8.0));
+  setEgo(34462, 10.0, 8.0);
+  plugin.update(0.0, 0.1);
+
+  const auto gap = 22.0 - 10.0 - 4.0;
+  const auto acceleration = std::max(
+    idm::calculateAcceleration(8.0, 10.0, idm::Neighbour{gap, 4.0}),
+    -traffic_simulator_msgs::msg::DynamicConstraints().max_deceleration);
+  const auto updated_speed = 8.0 + acceleration * 0.1;
+  const auto updated_status = plugin.getUpdatedStatus();
+  ASSERT_TRUE(updated_status);
+  EXPECT_LT(acceleration, 0.0);
+  EXPECT_EQ(plugin.getCurrentAction(), "follow_lane");
+  EXPECT_DOUBLE_EQ(updated_status->getTime(), 0.1);
+  EXPECT_EQ(updated_status->getLaneletPose().lanelet_id, 34462);
+  EXPECT_NEAR(updated_status->getLaneletPose().s, 10.0 + (8.0 + updated_speed) / 2.0 * 0.1, 1e-6);
+  EXPECT_NEAR(updated_status->getTwist().linear.x, updated_speed, 1e-9);
+  EXPECT_NEAR(updated_status->getAccel().linear.x, acceleration, 1e-9);
+  const auto obstacle = plugin.getObstacle();
+  ASSERT_TRUE(obstacle);
+  EXPECT_NEAR(obstacle->s, gap, 1e-6);
+}
+
+/// @note The ego overtakes its stopped leader on the free neighbouring lane.
+TEST_F(IntelligentDriverModelPlugin, ChangeLane)
+{
+  ASSERT_EQ(
+    hdmap_utils->getLaneChangeableLaneletId(34462, traffic_simulator::lane_change::Direction::LEFT),
+    34513);
+  snapshot->emplace("leader", makeEntityStatus("leader", 34462, 22.0, 0.0));
+  setEgo(34462, 10.0, 8.0);
+  const auto lanelet_pose =
+    hdmap_utils->toLaneletPose(plugin.getEntityStatus()->getMapPose(), 34513, 5.0);
+  ASSERT_TRUE(lanelet_pose);
+  plugin.update(0.0, 0.1);
+
+  const auto updated_status = plugin.getUpdatedStatus();
+  ASSERT_TRUE(updated_status);
+  EXPECT_EQ(plugin.getCurrentAction(), "lane_change");
+  EXPECT_EQ(updated_status->getLaneletPose().lanelet_id, 34513);
+  EXPECT_LT(
+    std::abs(updated_status->getLaneletPose().offset), std::abs(lanelet_pose->offset) - 1e-3);
+  /// @note The stopped leader is not on the new lane any more.
+  EXPECT_FALSE(plugin.getObstacle());
+  EXPECT_GT(updated_status->getTwist().linear.x, 8.0);
+}
+
+/// @note The ego stops at the end of its last route lanelet instead of running off the road.
+TEST_F(IntelligentDriverModelPlugin, EndOfRoad)
+{
+  auto behavior_parameter = traffic_simulator_msgs::msg::BehaviorParameter();
+  behavior_parameter.see_around = false;
+  plugin.setBehaviorParameter(behavior_parameter);
+  plugin.setRouteLanelets({34462});
+  const auto lanelet_length = hdmap_utils->getLaneletLength(34462);
+  setEgo(34462, lanelet_length - 0.5, 10.0);
+  plugin.update(0.0, 0.5);
+
+  const auto updated_status = plugin.getUpdatedStatus();
+  ASSERT_TRUE(updated_status);
+  EXPECT_EQ(updated_status->getLaneletPose().lanelet_id, 34462);
+  EXPECT_DOUBLE_EQ(updated_status->getLaneletPose().s, lanelet_length);
+}
+
+/// @note A step of no time leaves the ego where it is instead of dividing by zero.
+TEST_F(IntelligentDriverModelPlugin, ZeroStepTime)
+{
+  snapshot->emplace("leader", makeEntityStatus("leader", 34462, 22.0, 0.0));
+  setEgo(34462, 10.0, 8.0);
+  plugin.update(1.0, 0.0);
+
+  const auto updated_status = plugin.getUpdatedStatus();
+  ASSERT_TRUE(updated_status);
+  EXPECT_DOUBLE_EQ(updated_status->getTime(), 1.0);
+  EXPECT_EQ(updated_status->getLaneletPose().lanelet_id, 34462);
+  EXPECT_DOUBLE_EQ(updated_status->getLaneletPose().s, 10.0);
+  EXPECT_DOUBLE_EQ(updated_status->getTwist().linear.x, 8.0);
+  EXPECT_TRUE(std::isfinite(updated_status->getAccel().linear.x));
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
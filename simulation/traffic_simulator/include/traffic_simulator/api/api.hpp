@@ -21,6 +21,7 @@
 #include <autoware_auto_vehicle_msgs/msg/vehicle_state_command.hpp>
 #include <boost/variant.hpp>
 #include <cassert>
+#include <cstddef>
 #include <memory>
 #include <optional>
 #include <rclcpp/rclcpp.hpp>
@@ -39,6 +40,7 @@
 #include <traffic_simulator/helper/helper.hpp>
 #include <traffic_simulator/simulation_clock/simulation_clock.hpp>
 #include <traffic_simulator/traffic/traffic_controller.hpp>
+#include <traffic_simulator/traffic/traffic_source.hpp>
 #include <traffic_simulator/traffic_lights/traffic_light.hpp>
 #include <traffic_simulator_msgs/msg/behavior_parameter.hpp>
 #include <utility>
@@ -206,6 +208,29 @@ public:
   bool despawn(const std::string & name);
   bool despawnEntities();
 
+  /**
+   * @brief Adds a traffic source which spawns vehicles or pedestrians named "<name>_<number>" with
+   * the given parameters and behavior, and sets their initial speed.
+   */
+  template <typename Parameters>
+  auto addTrafficSource(
+    const std::string & name, const std::vector<CanonicalizedLaneletPose> & spawn_poses,
+    const traffic::TrafficSource::Configuration & source_configuration,
+    const Parameters & parameters, const std::string & behavior, double initial_speed = 0.0)
+    -> void
+  {
+    traffic_controller_ptr_->addModule<traffic::TrafficSource>(
+      name, spawn_poses, source_configuration, [this]() { return getEntityNames(); },
+      [this](const auto & entity_name) { return getMapPose(entity_name); },
+      [this, parameters, behavior, initial_speed](
+        const auto & entity_name, const auto & spawn_pose) {
+        if (spawn(entity_name, spawn_pose, parameters, behavior)) {
+          setLinearVelocity(entity_name, initial_speed);
+        }
+      },
+      [this]() { return getCurrentTime(); });
+  }
+
   auto setEntityStatus(const std::string & name, const CanonicalizedEntityStatus &) -> void;
   auto setEntityStatus(
     const std::string & name, const geometry_msgs::msg::Pose & map_pose,
@@ -255,6 +280,9 @@ public:
     const std::string &, const std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory> &)
     -> bool;
 
+  auto requestReplayTrajectory(
+    const std::string &, const std::shared_ptr<const replay_trajectory::Trajectory> &) -> void;
+
   void requestLaneChange(const std::string & name, const std::int64_t & lanelet_id);
 
   void requestLaneChange(const std::string & name, const lane_change::Direction & direction);
@@ -287,6 +315,7 @@ public:
   FORWARD_TO_ENTITY_MANAGER(getBehaviorParameter);
   FORWARD_TO_ENTITY_MANAGER(getBoundingBox);
   FORWARD_TO_ENTITY_MANAGER(getBoundingBoxDistance);
+  FORWARD_TO_ENTITY_MANAGER(getCollidingEntities);
   FORWARD_TO_ENTITY_MANAGER(getCurrentAccel);
   FORWARD_TO_ENTITY_MANAGER(getCurrentAction);
   FORWARD_TO_ENTITY_MANAGER(getCurrentTwist);
@@ -294,9 +323,11 @@ public:
   FORWARD_TO_ENTITY_MANAGER(getDistanceToLeftLaneBound);
   FORWARD_TO_ENTITY_MANAGER(getDistanceToRightLaneBound);
   FORWARD_TO_ENTITY_MANAGER(getEgoName);
+  FORWARD_TO_ENTITY_MANAGER(getEntityHandle);
   FORWARD_TO_ENTITY_MANAGER(getEntityNames);
   FORWARD_TO_ENTITY_MANAGER(getEntityStatus);
   FORWARD_TO_ENTITY_MANAGER(getEntityStatusBeforeUpdate);
+  FORWARD_TO_ENTITY_MANAGER(getEntityType);
   FORWARD_TO_ENTITY_MANAGER(getLaneletPose);
   FORWARD_TO_ENTITY_MANAGER(getLateralDistance);
   FORWARD_TO_ENTITY_MANAGER(getLinearJerk);
@@ -357,6 +388,15 @@ private:
 
   const rclcpp::Publisher<visualization_msgs::msg::MarkerArray>::SharedPtr debug_marker_pub_;
 
+  /// @note Subscribers of debug_marker_pub_ on the last frame.
+  std::size_t debug_marker_subscription_count_ = 0;
+
+  /**
+   * @note Set when the subscribers of debug_marker_pub_ change, since a new or replaced subscriber
+   * needs all markers instead of their difference from the last publication.
+   */
+  bool debug_marker_reset_ = true;
+
   SimulationClock clock_;
 
   zeromq::MultiClient zeromq_client_;
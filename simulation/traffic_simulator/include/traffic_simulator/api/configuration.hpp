@@ -20,6 +20,7 @@
 #include <boost/filesystem.hpp>
 #include <boost/filesystem/operations.hpp>
 #include <boost/range/iterator_range.hpp>
+#include <cstddef>
 #include <iomanip>
 #include <scenario_simulator_exception/exception.hpp>
 #include <string>
@@ -44,6 +45,12 @@ struct Configuration
 
   double v2i_traffic_light_publish_rate = 10.0;
 
+  /**
+   * @note Entity statuses, debug markers and entity transforms are published once every this
+   * number of frames. Topics without subscribers are not published at all.
+   */
+  std::size_t publish_decimation = 1;
+
   /* ---- NOTE -----------------------------------------------------------------
    *
    *  This setting comes from the argument of the same name (= `map_path`) in
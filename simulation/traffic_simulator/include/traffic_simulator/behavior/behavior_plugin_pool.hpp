@@ -0,0 +1,55 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__BEHAVIOR__BEHAVIOR_PLUGIN_POOL_HPP_
+#define TRAFFIC_SIMULATOR__BEHAVIOR__BEHAVIOR_PLUGIN_POOL_HPP_
+
+#include <memory>
+#include <pluginlib/class_loader.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <string>
+#include <traffic_simulator/behavior/behavior_plugin_base.hpp>
+#include <unordered_map>
+#include <vector>
+
+namespace traffic_simulator
+{
+/**
+ * @brief Keeps the behavior plugins of despawned entities and hands them out again to new entities
+ * with the same plugin name, so that spawning an entity does not load the plugin library, register
+ * the behavior tree nodes and parse the behavior tree XML again.
+ * @note A plugin acquired from the pool goes back to the pool when its last owner releases it.
+ */
+class BehaviorPluginPool : public std::enable_shared_from_this<BehaviorPluginPool>
+{
+public:
+  BehaviorPluginPool();
+
+  /// @note Returns a configured plugin, reusing an idle one if it can be reset.
+  auto acquire(const std::string & plugin_name, const rclcpp::Logger & logger)
+    -> std::shared_ptr<entity_behavior::BehaviorPluginBase>;
+
+  /// @note Number of idle plugins of plugin_name.
+  auto size(const std::string & plugin_name) const -> std::size_t;
+
+private:
+  /// @note Declared before idle_plugins_, since the plugins must be destroyed before the loader.
+  pluginlib::ClassLoader<entity_behavior::BehaviorPluginBase> loader_;
+
+  std::unordered_map<std::string, std::vector<std::shared_ptr<entity_behavior::BehaviorPluginBase>>>
+    idle_plugins_;
+};
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__BEHAVIOR__BEHAVIOR_PLUGIN_POOL_HPP_
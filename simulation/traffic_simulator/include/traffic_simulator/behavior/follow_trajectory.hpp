@@ -15,18 +15,68 @@
 #ifndef TRAFFIC_SIMULATOR__BEHAVIOR__FOLLOW_TRAJECTORY_HPP_
 #define TRAFFIC_SIMULATOR__BEHAVIOR__FOLLOW_TRAJECTORY_HPP_
 
+#include <memory>
 #include <optional>
 #include <traffic_simulator_msgs/msg/behavior_parameter.hpp>
 #include <traffic_simulator_msgs/msg/entity_status.hpp>
 #include <traffic_simulator_msgs/msg/polyline_trajectory.hpp>
+#include <traffic_simulator_msgs/msg/vertex.hpp>
+#include <utility>
+#include <vector>
 
 namespace traffic_simulator
 {
 namespace follow_trajectory
 {
+/**
+ * @brief Waypoints of a polyline trajectory which are not passed yet. Passing a waypoint only moves
+ * the cursor instead of erasing the waypoint from the trajectory, and the length of each segment of
+ * the polyline is calculated once, so that the cost of a frame does not grow with the number of
+ * vertices. The vertices of the trajectory must not be modified while the cursor is in use.
+ */
+class Cursor
+{
+public:
+  explicit Cursor(const std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory> &);
+
+  auto getPolylineTrajectory() const noexcept -> const auto & { return polyline_trajectory_; }
+
+  /// @note Number of waypoints not passed yet. A closed trajectory never runs out of waypoints.
+  auto size() const noexcept { return size_; }
+  auto empty() const noexcept { return size_ == 0; }
+
+  /// @note The index-th waypoint from the front, in the order in which the entity passes them.
+  auto operator[](std::size_t index) const -> const traffic_simulator_msgs::msg::Vertex &;
+  auto front() const -> const traffic_simulator_msgs::msg::Vertex & { return (*this)[0]; }
+
+  /// @note Passes the front waypoint. The front waypoint of a closed trajectory goes to the back.
+  auto pop() -> void;
+
+  /// @note Index from the front of the first waypoint whose arrival time is specified.
+  auto findFirstWaypointWithArrivalTime() const -> std::optional<std::size_t>;
+
+  /// @note Length of the polyline from the front waypoint to the index-th waypoint from the front.
+  auto getLengthTo(std::size_t index) -> double;
+
+private:
+  std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory> polyline_trajectory_;
+
+  /// @note Length of the segment from the i-th vertex to the next one, including the closing one.
+  std::vector<double> segment_lengths_;
+
+  /// @note Index of the first vertex at or after the i-th one whose arrival time is specified.
+  std::vector<std::size_t> next_vertex_with_arrival_time_;
+
+  std::size_t front_ = 0;
+
+  std::size_t size_ = 0;
+
+  /// @note The last result of getLengthTo, valid until the front waypoint is passed.
+  std::optional<std::pair<std::size_t, double>> length_cache_;
+};
+
 auto makeUpdatedStatus(
-  const traffic_simulator_msgs::msg::EntityStatus &,
-  std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory> &,
+  const traffic_simulator_msgs::msg::EntityStatus &, Cursor &,
   const traffic_simulator_msgs::msg::BehaviorParameter &, double step_time)
   -> std::optional<traffic_simulator_msgs::msg::EntityStatus>;
 }  // namespace follow_trajectory
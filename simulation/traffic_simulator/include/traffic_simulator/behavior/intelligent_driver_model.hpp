@@ -0,0 +1,120 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__BEHAVIOR__INTELLIGENT_DRIVER_MODEL_HPP_
+#define TRAFFIC_SIMULATOR__BEHAVIOR__INTELLIGENT_DRIVER_MODEL_HPP_
+
+#include <cstdint>
+#include <optional>
+#include <traffic_simulator/data_type/entity_status_snapshot.hpp>
+#include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
+#include <traffic_simulator_msgs/msg/bounding_box.hpp>
+#include <vector>
+
+namespace traffic_simulator
+{
+/**
+ * @brief Intelligent driver model (Treiber, Hennecke and Helbing, 2000) for car following and
+ * MOBIL (Kesting, Treiber and Helbing, 2007) for lane changing.
+ * A vehicle is only described by its position along a lane and its speed, and only interacts with
+ * the vehicles directly in front of and behind it, which are looked up in the lanelet buckets of
+ * the shared EntityStatusSnapshot. The model has no random term, so the result only depends on the
+ * statuses in the snapshot.
+ */
+namespace intelligent_driver_model
+{
+struct Parameter
+{
+  /// @note Desired time gap to the leader [s].
+  double time_headway = 1.5;
+
+  /// @note Gap to the leader kept at standstill [m].
+  double minimum_gap = 2.0;
+
+  /// @note Maximum acceleration [m/s^2] and comfortable deceleration [m/s^2] of the model.
+  double acceleration = 1.5;
+  double comfortable_deceleration = 2.0;
+
+  /// @note How fast the free road acceleration falls when the speed approaches the desired speed.
+  double acceleration_exponent = 4.0;
+
+  /**
+   * @note Weight of the acceleration changes of the followers in the lane change incentive.
+   * 0 means a selfish driver, 1 means a driver who values the followers as much as itself.
+   */
+  double politeness = 0.2;
+
+  /// @note Minimum incentive to change lanes, which prevents lane changes back and forth [m/s^2].
+  double lane_change_threshold = 0.1;
+
+  /// @note Lane changes which force the new follower to brake harder than this are unsafe [m/s^2].
+  double safe_deceleration = 4.0;
+
+  /// @note Lateral speed towards the centerline of the target lane during a lane change [m/s].
+  double lateral_speed = 1.0;
+
+  /// @note Distance along the lane behind the vehicle in which followers are looked up [m].
+  double backward_distance = 50.0;
+};
+
+/// @note Bumper to bumper distance along the lane [m] and speed along the lane [m/s].
+struct Neighbour
+{
+  double gap;
+  double speed;
+};
+
+struct Neighbours
+{
+  std::optional<Neighbour> leader;
+  std::optional<Neighbour> follower;
+};
+
+/**
+ * @note Lanelets of one lane in driving direction, and the s of the start of each lanelet measured
+ * from the start of the lanelet the vehicle is on.
+ */
+struct Lane
+{
+  std::vector<std::int64_t> lanelet_ids;
+  std::vector<double> offsets;
+};
+
+/// @note following_lanelet_ids starts with the lanelet the vehicle is on, as route lanelets do.
+auto makeLane(
+  const hdmap_utils::HdMapUtils &, const std::vector<std::int64_t> & following_lanelet_ids,
+  const Parameter & = Parameter()) -> Lane;
+
+/// @note s is the position of the vehicle on the lanelet whose offset in the lane is 0.
+auto findNeighbours(
+  const OtherEntityStatusView & other_entity_status, const Lane & lane, double s,
+  const traffic_simulator_msgs::msg::BoundingBox & bounding_box) -> Neighbours;
+
+/// @note Free road acceleration if there is no leader.
+auto calculateAcceleration(
+  double speed, double desired_speed, const std::optional<Neighbour> & leader,
+  const Parameter & = Parameter()) -> double;
+
+/**
+ * @note Advantage of changing from the current lane to the target lane [m/s^2], or std::nullopt if
+ * the lane change is unsafe. Followers are assumed to drive at desired_speed on a free road.
+ * The lane change is beneficial if the result exceeds Parameter::lane_change_threshold.
+ */
+auto calculateLaneChangeIncentive(
+  double speed, double desired_speed, double length, const Neighbours & current_lane,
+  const Neighbours & target_lane, const Parameter & = Parameter()) -> std::optional<double>;
+}  // namespace intelligent_driver_model
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__BEHAVIOR__INTELLIGENT_DRIVER_MODEL_HPP_
@@ -15,6 +15,7 @@
 #ifndef TRAFFIC_SIMULATOR__BEHAVIOR__LONGITUDINAL_SPEED_PLANNING_HPP_
 #define TRAFFIC_SIMULATOR__BEHAVIOR__LONGITUDINAL_SPEED_PLANNING_HPP_
 
+#include <string>
 #include <traffic_simulator_msgs/msg/action_status.hpp>
 #include <traffic_simulator_msgs/msg/dynamic_constraints.hpp>
 #include <tuple>
@@ -41,6 +42,7 @@ public:
     const geometry_msgs::msg::Accel & current_accel, double acceleration_duration,
     const traffic_simulator_msgs::msg::DynamicConstraints & constraints)
     -> traffic_simulator_msgs::msg::DynamicConstraints;
+  /// @note Distance travelled while stepping getDynamicStates until target_speed is reached.
   auto getRunningDistance(
     double target_speed, const traffic_simulator_msgs::msg::DynamicConstraints &,
     const geometry_msgs::msg::Twist & current_twist,
@@ -52,8 +54,10 @@ public:
   auto isTargetSpeedReached(
     double target_speed, const geometry_msgs::msg::Twist & current_twist,
     double tolerance = 0.01) const noexcept -> bool;
-  const double step_time;
-  const std::string entity;
+  auto getStepTime() const noexcept { return step_time_; }
+  auto getEntity() const noexcept -> const std::string & { return entity_; }
+  /// @note Lets an entity keep one planner for its lifetime instead of constructing one per frame.
+  auto setStepTime(double step_time) noexcept -> void { step_time_ = step_time; }
 
 private:
   auto isReachedToTargetSpeedWithConstantJerk(
@@ -97,6 +101,9 @@ private:
   auto timeDerivative(
     const geometry_msgs::msg::Accel & before, const geometry_msgs::msg::Accel & after) const
     -> double;
+
+  double step_time_;
+  const std::string entity_;
 };
 
 }  // namespace longitudinal_speed_planning
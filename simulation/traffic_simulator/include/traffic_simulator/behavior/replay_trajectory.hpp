@@ -0,0 +1,118 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__BEHAVIOR__REPLAY_TRAJECTORY_HPP_
+#define TRAFFIC_SIMULATOR__BEHAVIOR__REPLAY_TRAJECTORY_HPP_
+
+#include <geometry_msgs/msg/pose.hpp>
+#include <geometry_msgs/msg/twist.hpp>
+#include <memory>
+#include <optional>
+#include <string>
+#include <traffic_simulator_msgs/msg/entity_status.hpp>
+#include <vector>
+
+namespace traffic_simulator
+{
+/**
+ * @brief Replay of a timestamped state sequence recorded from a real world log. Unlike
+ * FollowTrajectoryAction, the entity is placed exactly at the state interpolated for each frame,
+ * bypassing dynamic constraints, so that the cost of a frame is constant and logged agents can be
+ * injected into a scenario in large numbers.
+ */
+namespace replay_trajectory
+{
+struct State
+{
+  /// @note Time relative to any origin, only the difference from the first state matters [s].
+  double time;
+
+  geometry_msgs::msg::Pose pose;
+
+  /// @note Velocity in the entity frame, in the same convention as EntityStatus.
+  geometry_msgs::msg::Twist twist;
+};
+
+enum class Interpolation {
+  /// @note Positions, orientations and twists are interpolated linearly.
+  LINEAR,
+  /// @note Positions are interpolated by cubic Hermite splines which also match the recorded
+  /// velocities, so that the path is smooth at the recorded states.
+  CUBIC_HERMITE,
+};
+
+class Trajectory
+{
+public:
+  /// @note Throws SemanticError if states are empty, not finite, or not sorted by time.
+  explicit Trajectory(std::vector<State>, Interpolation = Interpolation::LINEAR);
+
+  /**
+   * @brief Loads a trajectory from a CSV file if the path ends with ".csv", otherwise from the
+   * binary format written by save. A CSV line has 14 columns: time, position (x, y, z),
+   * orientation (x, y, z, w), linear velocity (x, y, z) and angular velocity (x, y, z).
+   * Empty lines, lines starting with '#' and a header on the first line are skipped.
+   */
+  static auto load(const std::string & path, Interpolation = Interpolation::LINEAR) -> Trajectory;
+
+  /// @note Saves the trajectory in a compact binary format, 14 float64 values per state.
+  auto save(const std::string & path) const -> void;
+
+  auto getStates() const noexcept -> const std::vector<State> & { return states_; }
+
+  auto getInterpolation() const noexcept { return interpolation_; }
+
+  auto getDuration() const -> double { return states_.back().time - states_.front().time; }
+
+  /**
+   * @brief State at elapsed_time from the first state, clamped to the recorded duration. hint is
+   * the index of the segment found by the previous call. Monotonic queries only advance it by a few
+   * segments, and other queries fall back to a binary search.
+   */
+  auto interpolate(double elapsed_time, std::size_t & hint) const -> State;
+
+private:
+  std::vector<State> states_;
+
+  Interpolation interpolation_;
+};
+
+/// @note Progress of an entity along a shared Trajectory.
+class Cursor
+{
+public:
+  /// @note Throws SemanticError if the trajectory is null.
+  explicit Cursor(const std::shared_ptr<const Trajectory> &);
+
+  auto getTrajectory() const noexcept -> const auto & { return trajectory_; }
+
+  /**
+   * @brief Places the entity at the state recorded for the time one step after the status,
+   * measured from the first replayed frame. Returns std::nullopt after the end of the trajectory.
+   */
+  auto makeUpdatedStatus(const traffic_simulator_msgs::msg::EntityStatus &, double step_time)
+    -> std::optional<traffic_simulator_msgs::msg::EntityStatus>;
+
+private:
+  std::shared_ptr<const Trajectory> trajectory_;
+
+  /// @note Simulation time at which the first state of the trajectory is replayed.
+  std::optional<double> start_time_;
+
+  std::size_t hint_ = 0;
+};
+}  // namespace replay_trajectory
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__BEHAVIOR__REPLAY_TRAJECTORY_HPP_
@@ -15,14 +15,24 @@
 #ifndef BEHAVIOR_TREE_PLUGIN__ROUTE_PLANNER_HPP_
 #define BEHAVIOR_TREE_PLUGIN__ROUTE_PLANNER_HPP_
 
+#include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <memory>
+#include <optional>
 #include <traffic_simulator/data_type/entity_status.hpp>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
 #include <vector>
 
 namespace traffic_simulator
 {
+struct CacheStatistics
+{
+  std::size_t hits = 0;
+
+  std::size_t misses = 0;
+};
+
 class RoutePlanner
 {
 public:
@@ -37,12 +47,43 @@ public:
   auto getGoalPoses() const -> std::vector<CanonicalizedLaneletPose>;
   auto getGoalPosesInWorldFrame() const -> std::vector<geometry_msgs::msg::Pose>;
 
+  auto getCacheStatistics() const noexcept -> const CacheStatistics & { return cache_statistics_; }
+
 private:
+  /**
+   * @note Following lanelets of lanelet_id within horizon, along route_ if along_route is true.
+   * The result is reused until the lanelet, the horizon or the route changes.
+   */
+  auto getFollowingLanelets(std::int64_t lanelet_id, double horizon, bool along_route)
+    -> std::vector<std::int64_t>;
+
+  auto setRoute(const std::optional<std::vector<std::int64_t>> & route) -> void;
+
   auto cancelWaypoint(const CanonicalizedLaneletPose & entity_lanelet_pose) -> void;
 
   auto updateRoute(const CanonicalizedLaneletPose & entity_lanelet_pose) -> void;
 
   std::optional<std::vector<std::int64_t>> route_;
+
+  /// @note Incremented whenever route_ is assigned, so that route_horizon_ can tell a new route.
+  std::uint64_t route_version_ = 0;
+
+  struct RouteHorizon
+  {
+    std::int64_t lanelet_id;
+
+    double horizon;
+
+    /// @note route_version_ of the route the lanelets follow, or std::nullopt if not along a route.
+    std::optional<std::uint64_t> route_version;
+
+    std::vector<std::int64_t> lanelet_ids;
+  };
+
+  std::optional<RouteHorizon> route_horizon_;
+
+  CacheStatistics cache_statistics_;
+
   std::shared_ptr<hdmap_utils::HdMapUtils> hdmap_utils_ptr_;
 
   /*
@@ -0,0 +1,73 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__BEHAVIOR__SOCIAL_FORCE_HPP_
+#define TRAFFIC_SIMULATOR__BEHAVIOR__SOCIAL_FORCE_HPP_
+
+#include <geometry_msgs/msg/vector3.hpp>
+#include <traffic_simulator/data_type/entity_status.hpp>
+#include <traffic_simulator/data_type/entity_status_snapshot.hpp>
+#include <traffic_simulator_msgs/msg/behavior_parameter.hpp>
+#include <traffic_simulator_msgs/msg/entity_status.hpp>
+
+namespace traffic_simulator
+{
+/**
+ * @brief Social force model (Helbing and Molnar, 1995) of a pedestrian walking straight.
+ * The pedestrian relaxes towards its desired velocity along its heading and is repelled by the
+ * bounding boxes of nearby entities, so that it slows down and sidesteps instead of walking through
+ * other pedestrians and vehicles. Nearby entities are found in the uniform grid of the shared
+ * EntityStatusSnapshot, so one update costs time proportional to the number of neighbours.
+ * The model has no random term, so the result only depends on the statuses in the snapshot.
+ */
+namespace social_force
+{
+struct Parameter
+{
+  /// @note Time in which the pedestrian recovers its desired velocity [s].
+  double relaxation_time = 0.5;
+
+  /// @note Strength [m/s^2] and range [m] of the repulsion from other entities.
+  double interaction_strength = 2.1;
+  double interaction_range = 1.0;
+
+  /// @note Weight of the repulsion from entities behind the pedestrian, 1 means isotropic.
+  double anisotropy = 0.35;
+
+  /**
+   * @note Ratio of the repulsion from entities ahead which is also applied towards the right of the
+   * pedestrian. Without it, two pedestrians walking head-on to each other only slow down.
+   */
+  double right_hand_bias = 1.0;
+
+  /// @note Entities whose bounding box is farther than this from the pedestrian are ignored [m].
+  double neighbour_distance = 3.0;
+};
+
+/// @note Acceleration in the body frame of the pedestrian.
+auto calculateAcceleration(
+  const CanonicalizedEntityStatus & pedestrian, double target_speed,
+  const OtherEntityStatusView & other_entity_status, const Parameter & = Parameter())
+  -> geometry_msgs::msg::Vector3;
+
+/// @note The pedestrian keeps its orientation, sidestepping is expressed as lateral velocity.
+auto makeUpdatedStatus(
+  const CanonicalizedEntityStatus & pedestrian, double target_speed,
+  const OtherEntityStatusView & other_entity_status,
+  const traffic_simulator_msgs::msg::BehaviorParameter &, double step_time,
+  const Parameter & = Parameter()) -> traffic_simulator_msgs::msg::EntityStatus;
+}  // namespace social_force
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__BEHAVIOR__SOCIAL_FORCE_HPP_
@@ -0,0 +1,102 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__BEHAVIOR__TICK_PROFILER_HPP_
+#define TRAFFIC_SIMULATOR__BEHAVIOR__TICK_PROFILER_HPP_
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace traffic_simulator
+{
+namespace behavior
+{
+/**
+ * @brief Process wide call counts and duration histograms of behavior nodes, aggregated by node
+ * type across all entities. Behavior plugins are expected to check isEnabled() before reading the
+ * clock, so that a disabled profiler costs one relaxed atomic load per tick.
+ */
+class TickProfiler
+{
+public:
+  class Statistics
+  {
+  public:
+    /// @note Bucket i counts durations in [2^i, 2^(i+1)) nanoseconds, the last one is open ended.
+    static constexpr std::size_t number_of_buckets = 40;
+
+    auto record(std::chrono::nanoseconds duration) noexcept -> void;
+
+    auto reset() noexcept -> void;
+
+    auto count() const noexcept { return count_.load(std::memory_order_relaxed); }
+
+  private:
+    friend class TickProfiler;
+
+    std::atomic<std::uint64_t> count_ = 0;
+
+    std::atomic<std::uint64_t> total_nanoseconds_ = 0;
+
+    std::atomic<std::uint64_t> minimum_nanoseconds_ = UINT64_MAX;
+
+    std::atomic<std::uint64_t> maximum_nanoseconds_ = 0;
+
+    std::array<std::atomic<std::uint64_t>, number_of_buckets> histogram_ = {};
+  };
+
+  static auto get() -> TickProfiler &;
+
+  auto enable(bool enabled = true) noexcept -> void
+  {
+    enabled_.store(enabled, std::memory_order_relaxed);
+  }
+
+  auto isEnabled() const noexcept -> bool { return enabled_.load(std::memory_order_relaxed); }
+
+  /// @note The returned reference stays valid for the lifetime of the process, so it can be cached.
+  auto getStatistics(const std::string & node_type) -> Statistics &;
+
+  /// @note Clears the recorded values, node types already seen are kept.
+  auto reset() -> void;
+
+  /**
+   * @brief Recorded values keyed by node type, for example:
+   * {"FollowLane": {"count": 2, "total_ns": 3000, "mean_ns": 1500, "min_ns": 1000,
+   * "max_ns": 2000, "histogram": [{"lower_ns": 512, "upper_ns": 1024, "count": 1}, ...]}}
+   * Empty buckets and node types never ticked are omitted.
+   */
+  auto toJson() const -> std::string;
+
+  auto dump(const std::string & path) const -> void;
+
+private:
+  TickProfiler() = default;
+
+  std::atomic<bool> enabled_ = false;
+
+  mutable std::mutex mutex_;
+
+  std::map<std::string, std::unique_ptr<Statistics>> statistics_;
+};
+}  // namespace behavior
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__BEHAVIOR__TICK_PROFILER_HPP_
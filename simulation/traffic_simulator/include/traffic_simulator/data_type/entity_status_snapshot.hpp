@@ -0,0 +1,199 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__DATA_TYPE__ENTITY_STATUS_SNAPSHOT_HPP_
+#define TRAFFIC_SIMULATOR__DATA_TYPE__ENTITY_STATUS_SNAPSHOT_HPP_
+
+#include <cstdint>
+#include <geometry_msgs/msg/point.hpp>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <traffic_simulator/data_type/entity_status.hpp>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace traffic_simulator
+{
+/**
+ * @brief Statuses of all entities at one point of a frame, stored in a dense array with a
+ * name -> index table. A snapshot is filled by EntityManager and shared read-only by the entities.
+ * Entities are also indexed by a uniform grid over their map positions and by the lanelet they are
+ * matched to, so that neighbours can be found without visiting every entity.
+ */
+class EntityStatusSnapshot
+{
+public:
+  using value_type = std::pair<const std::string, CanonicalizedEntityStatus>;
+  using const_iterator = std::vector<value_type>::const_iterator;
+
+  auto emplace(const std::string & name, const CanonicalizedEntityStatus & status) -> void;
+
+  /**
+   * @note Keeps the allocated storage, so that a snapshot can be refilled on the next frame.
+   * Index entries of names and cells which were not used since the previous clear are released.
+   */
+  auto clear() -> void;
+
+  auto begin() const noexcept { return entries_.begin(); }
+  auto end() const noexcept { return entries_.end(); }
+  auto size() const noexcept { return entries_.size(); }
+  auto empty() const noexcept { return entries_.empty(); }
+
+  auto indexOf(const std::string & name) const -> std::optional<std::size_t>;
+  auto find(const std::string & name) const -> const_iterator;
+  auto at(const std::string & name) const -> const CanonicalizedEntityStatus &;
+
+  auto operator[](std::size_t index) const -> const value_type & { return entries_[index]; }
+
+  /// @note Indices of entities whose position is within radius of point in 2D, in ascending order.
+  auto indicesWithin(const geometry_msgs::msg::Point & point, double radius) const
+    -> std::vector<std::size_t>;
+
+  /// @note Indices of lane matched entities on any of lanelet_ids, in ascending order.
+  auto indicesOnLanelets(const std::vector<std::int64_t> & lanelet_ids) const
+    -> std::vector<std::size_t>;
+
+  /// @note Indices of lane matched entities on lanelet_id, in ascending order.
+  auto indicesOnLanelet(std::int64_t lanelet_id) const -> const std::vector<std::size_t> &;
+
+  /// @note The largest distance from an entity position to a corner of its bounding box.
+  auto getMaximumBoundingRadius() const noexcept { return maximum_bounding_radius_; }
+
+  static constexpr double grid_cell_size = 20.0;
+
+private:
+  static auto toGridCell(double x, double y) -> std::pair<std::int64_t, std::int64_t>;
+
+  static auto toGridKey(std::int64_t cell_x, std::int64_t cell_y) -> std::int64_t;
+
+  std::vector<value_type> entries_;
+
+  /// @note Names of the entities before the last clear are kept with unused_index.
+  std::unordered_map<std::string, std::size_t> indices_;
+
+  static constexpr auto unused_index = std::numeric_limits<std::size_t>::max();
+
+  std::unordered_map<std::int64_t, std::vector<std::size_t>> grid_;
+
+  std::unordered_map<std::int64_t, std::vector<std::size_t>> lanelet_buckets_;
+
+  double maximum_bounding_radius_ = 0.0;
+};
+
+/**
+ * @brief Snapshots refilled by EntityManager on every frame. A snapshot is reused once it is only
+ * referred to by the pool. Entities keep the snapshot published last and behavior plugins keep the
+ * one they were updated with, so the pool holds three snapshots in a steady state.
+ */
+class EntityStatusSnapshotPool
+{
+public:
+  /// @note Cleared snapshot which is not referred to from outside of the pool.
+  auto acquire() -> std::shared_ptr<EntityStatusSnapshot>;
+
+  auto size() const noexcept { return snapshots_.size(); }
+
+private:
+  std::vector<std::shared_ptr<EntityStatusSnapshot>> snapshots_;
+};
+
+/**
+ * @brief Read-only view of an EntityStatusSnapshot which hides the entity who owns the view.
+ * Copying the view only copies a shared pointer to the snapshot.
+ */
+class OtherEntityStatusView
+{
+public:
+  using value_type = EntityStatusSnapshot::value_type;
+
+  class const_iterator
+  {
+  public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = OtherEntityStatusView::value_type;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const value_type *;
+    using reference = const value_type &;
+
+    const_iterator() = default;
+    explicit const_iterator(
+      EntityStatusSnapshot::const_iterator iter, EntityStatusSnapshot::const_iterator skip,
+      EntityStatusSnapshot::const_iterator last)
+    : iter_(iter == skip and iter != last ? std::next(iter) : iter), skip_(skip), last_(last)
+    {
+    }
+
+    auto operator*() const -> reference { return *iter_; }
+    auto operator->() const -> pointer { return &*iter_; }
+    auto operator++() -> const_iterator &
+    {
+      if (++iter_ == skip_ and iter_ != last_) {
+        ++iter_;
+      }
+      return *this;
+    }
+    auto operator++(int) -> const_iterator
+    {
+      auto copy = *this;
+      ++*this;
+      return copy;
+    }
+    auto operator==(const const_iterator & other) const { return iter_ == other.iter_; }
+    auto operator!=(const const_iterator & other) const { return iter_ != other.iter_; }
+
+  private:
+    EntityStatusSnapshot::const_iterator iter_, skip_, last_;
+  };
+
+  OtherEntityStatusView();
+  explicit OtherEntityStatusView(
+    const std::shared_ptr<const EntityStatusSnapshot> & snapshot, const std::string & owner_name);
+
+  auto begin() const -> const_iterator;
+  auto end() const -> const_iterator;
+  auto size() const -> std::size_t;
+  auto empty() const -> bool { return size() == 0; }
+  auto count(const std::string & name) const -> std::size_t;
+  auto find(const std::string & name) const -> const_iterator;
+  auto at(const std::string & name) const -> const CanonicalizedEntityStatus &;
+
+  /// @note Other entities whose position is within radius of point in 2D, in iteration order.
+  auto getEntitiesWithin(const geometry_msgs::msg::Point & point, double radius) const
+    -> std::vector<const value_type *>;
+
+  /// @note Other lane matched entities on any of lanelet_ids, in iteration order.
+  auto getEntitiesOnLanelets(const std::vector<std::int64_t> & lanelet_ids) const
+    -> std::vector<const value_type *>;
+
+  /// @note Same as not getEntitiesOnLanelets(lanelet_ids).empty(), without collecting entities.
+  auto existsOnLanelets(const std::vector<std::int64_t> & lanelet_ids) const -> bool;
+
+  auto getMaximumBoundingRadius() const noexcept { return snapshot_->getMaximumBoundingRadius(); }
+
+private:
+  auto getEntities(const std::vector<std::size_t> & indices) const
+    -> std::vector<const value_type *>;
+
+  std::shared_ptr<const EntityStatusSnapshot> snapshot_;
+
+  /// @note Index of the owner in snapshot_, equal to the snapshot size if the owner is not in it.
+  std::size_t owner_index_;
+};
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__DATA_TYPE__ENTITY_STATUS_SNAPSHOT_HPP_
@@ -47,7 +47,8 @@ public:
   explicit EgoEntity(
     const std::string & name, const CanonicalizedEntityStatus &,
     const std::shared_ptr<hdmap_utils::HdMapUtils> &,
-    const traffic_simulator_msgs::msg::VehicleParameters &, const Configuration &);
+    const traffic_simulator_msgs::msg::VehicleParameters &, const Configuration &,
+    const std::shared_ptr<BehaviorPluginPool> &);
 
   explicit EgoEntity(EgoEntity &&) = delete;
 
@@ -96,6 +97,9 @@ public:
 
   auto requestLaneChange(const traffic_simulator::lane_change::Parameter &) -> void override;
 
+  auto requestReplayTrajectory(const std::shared_ptr<const replay_trajectory::Trajectory> &)
+    -> void override;
+
   auto requestSpeedChange(
     const double, const speed_change::Transition, const speed_change::Constraint,
     const bool continuous) -> void override;
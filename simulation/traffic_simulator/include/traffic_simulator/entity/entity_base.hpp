@@ -24,7 +24,9 @@
 #include <string>
 #include <traffic_simulator/behavior/follow_trajectory.hpp>
 #include <traffic_simulator/behavior/longitudinal_speed_planning.hpp>
+#include <traffic_simulator/behavior/replay_trajectory.hpp>
 #include <traffic_simulator/data_type/entity_status.hpp>
+#include <traffic_simulator/data_type/entity_status_snapshot.hpp>
 #include <traffic_simulator/data_type/lane_change.hpp>
 #include <traffic_simulator/data_type/speed_change.hpp>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
@@ -177,6 +179,14 @@ public:
   virtual auto requestFollowTrajectory(
     const std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory> &) -> void;
 
+  /**
+   * @brief Places the entity at the state of the trajectory for each frame from the next update,
+   * bypassing the behavior plugin and dynamic constraints. When the trajectory ends, the behavior
+   * plugin takes over the entity from the last replayed state.
+   */
+  virtual auto requestReplayTrajectory(const std::shared_ptr<const replay_trajectory::Trajectory> &)
+    -> void;
+
   virtual void requestWalkStraight();
 
   virtual void setAccelerationLimit(double acceleration) = 0;
@@ -192,9 +202,10 @@ public:
   virtual void setBehaviorParameter(const traffic_simulator_msgs::msg::BehaviorParameter &) = 0;
 
   /*   */ void setEntityTypeList(
-    const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> &);
+    const std::shared_ptr<
+      const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>> &);
 
-  /*   */ void setOtherStatus(const std::unordered_map<std::string, CanonicalizedEntityStatus> &);
+  /*   */ void setOtherStatus(const std::shared_ptr<const EntityStatusSnapshot> &);
 
   virtual auto setStatus(const CanonicalizedEntityStatus &) -> void;
 
@@ -229,6 +240,9 @@ public:
   bool verbose;
 
 protected:
+  /// @note Returns false if no trajectory is replayed, so that the behavior plugin updates status_.
+  auto updateReplayedStatus(double step_time) -> bool;
+
   CanonicalizedEntityStatus status_;
 
   CanonicalizedEntityStatus status_before_update_;
@@ -240,14 +254,18 @@ protected:
   double stand_still_duration_ = 0.0;
   double traveled_distance_ = 0.0;
 
-  std::unordered_map<std::string, CanonicalizedEntityStatus> other_status_;
-  std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> entity_type_list_;
+  OtherEntityStatusView other_status_;
+  /// @note Shared by all entities and replaced by EntityManager when an entity is (de)spawned.
+  std::shared_ptr<const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>>
+    entity_type_list_ = std::make_shared<
+      const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>>();
 
   std::optional<double> target_speed_;
   traffic_simulator::job::JobList job_list_;
 
-  std::unique_ptr<traffic_simulator::longitudinal_speed_planning::LongitudinalSpeedPlanner>
-    speed_planner_;
+  traffic_simulator::longitudinal_speed_planning::LongitudinalSpeedPlanner speed_planner_;
+
+  std::optional<replay_trajectory::Cursor> replay_trajectory_cursor_;
 
 private:
   virtual auto requestSpeedChangeWithConstantAcceleration(
@@ -0,0 +1,49 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__ENTITY__ENTITY_HANDLE_HPP_
+#define TRAFFIC_SIMULATOR__ENTITY__ENTITY_HANDLE_HPP_
+
+#include <cstdint>
+#include <limits>
+
+namespace traffic_simulator
+{
+namespace entity
+{
+/**
+ * @brief Index of an entity in EntityManager, which can be resolved without hashing the entity name.
+ * The generation is incremented when the entity is despawned, so a handle of a despawned entity is
+ * never resolved to another entity which reuses the index.
+ */
+struct EntityHandle
+{
+  std::uint32_t index = std::numeric_limits<std::uint32_t>::max();
+
+  std::uint32_t generation = 0;
+
+  constexpr auto operator==(const EntityHandle & other) const noexcept
+  {
+    return index == other.index and generation == other.generation;
+  }
+
+  constexpr auto operator!=(const EntityHandle & other) const noexcept
+  {
+    return not(*this == other);
+  }
+};
+}  // namespace entity
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__ENTITY__ENTITY_HANDLE_HPP_
@@ -26,19 +26,27 @@
 #endif
 
 #include <autoware_perception_msgs/msg/traffic_signal_array.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <optional>
 #include <rclcpp/node_interfaces/get_node_topics_interface.hpp>
 #include <rclcpp/node_interfaces/node_topics_interface.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <scenario_simulator_exception/exception.hpp>
+#include <std_srvs/srv/trigger.hpp>
 #include <stdexcept>
 #include <string>
 #include <traffic_simulator/api/configuration.hpp>
+#include <traffic_simulator/behavior/behavior_plugin_pool.hpp>
+#include <traffic_simulator/behavior/tick_profiler.hpp>
+#include <traffic_simulator/data_type/entity_status_snapshot.hpp>
 #include <traffic_simulator/data_type/lane_change.hpp>
 #include <traffic_simulator/data_type/speed_change.hpp>
 #include <traffic_simulator/entity/ego_entity.hpp>
 #include <traffic_simulator/entity/entity_base.hpp>
+#include <traffic_simulator/entity/entity_handle.hpp>
 #include <traffic_simulator/entity/misc_object_entity.hpp>
 #include <traffic_simulator/entity/pedestrian_entity.hpp>
 #include <traffic_simulator/entity/vehicle_entity.hpp>
@@ -50,6 +58,7 @@
 #include <traffic_simulator_msgs/msg/behavior_parameter.hpp>
 #include <traffic_simulator_msgs/msg/bounding_box.hpp>
 #include <traffic_simulator_msgs/msg/entity_status_with_trajectory_array.hpp>
+#include <traffic_simulator_msgs/msg/entity_type.hpp>
 #include <traffic_simulator_msgs/msg/vehicle_parameters.hpp>
 #include <type_traits>
 #include <unordered_map>
@@ -96,8 +105,79 @@ class EntityManager
 
   const rclcpp::Clock::SharedPtr clock_ptr_;
 
+  /// @note Behavior plugins of despawned vehicles and pedestrians, reused by the next spawned ones.
+  const std::shared_ptr<BehaviorPluginPool> behavior_plugin_pool_ =
+    std::make_shared<BehaviorPluginPool>();
+
   std::unordered_map<std::string, std::unique_ptr<traffic_simulator::entity::EntityBase>> entities_;
 
+  struct EntitySlot
+  {
+    EntityBase * entity = nullptr;
+
+    std::uint32_t generation = 0;
+
+    /// @note Entities colliding with this one at the end of the last update, sorted by name.
+    std::vector<EntityHandle> colliding_entities;
+
+    /// @note True if the entity is spawned or its status is set after the last update.
+    bool moved = false;
+  };
+
+  /// @note Entities indexed by EntityHandle::index. Slots of despawned entities are reused.
+  std::vector<EntitySlot> entity_slots_;
+
+  std::vector<std::uint32_t> free_entity_slots_;
+
+  std::unordered_map<std::string, EntityHandle> entity_handles_;
+
+  std::optional<EntityHandle> ego_handle_;
+
+  /// @note Types of all entities, updated in place when an entity is spawned or despawned.
+  std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> entity_type_list_;
+
+  /**
+   * @note Copy of entity_type_list_ shared by the entities. It is dropped when an entity is spawned
+   * or despawned and copied again when the entities are updated, so it is copied at most once per
+   * frame however many entities are spawned, while the entities keep the copy of the previous one.
+   */
+  std::shared_ptr<const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>>
+    shared_entity_type_list_;
+
+  /// @note Names of the entities of each EntityType::type, in spawned order.
+  std::unordered_map<std::uint8_t, std::vector<std::string>> entity_names_by_type_;
+
+  auto registerEntity(EntityBase &) -> EntityHandle;
+
+  auto unregisterEntity(const std::string & name) -> void;
+
+  auto resolve(const EntityHandle &) const -> EntityBase &;
+
+  /// @note Entity statuses shared by all entities, published last by publishEntityStatus.
+  std::shared_ptr<EntityStatusSnapshot> entity_status_snapshot_;
+
+  EntityStatusSnapshotPool entity_status_snapshot_pool_;
+
+  auto publishEntityStatus(const std::shared_ptr<EntityStatusSnapshot> &) -> void;
+
+  /**
+   * @note Entities moved after the last update. Collisions with them are checked when queried,
+   * instead of being read from EntitySlot::colliding_entities.
+   */
+  std::vector<EntityHandle> moved_entities_;
+
+  auto markMoved(const EntityHandle &) -> void;
+
+  auto updateCollidingEntities() -> void;
+
+  std::size_t frame_ = 0;
+
+  bool publishing_frame_ = true;
+
+  /// @note Debug markers sent by the last call of makeDebugMarkerDifference, by namespace and id.
+  std::map<std::pair<std::string, std::int32_t>, visualization_msgs::msg::Marker>
+    published_debug_markers_;
+
   double step_time_;
 
   double current_time_;
@@ -124,6 +204,11 @@ class EntityManager
   const std::shared_ptr<TrafficLightPublisherBase> v2i_traffic_light_publisher_ptr_;
   ConfigurableRateUpdater v2i_traffic_light_updater_, conventional_traffic_light_updater_;
 
+  /// @note The tick profile of behavior nodes is written to this path when the scenario ends.
+  const std::string behavior_tick_profile_path_;
+
+  const rclcpp::Service<std_srvs::srv::Trigger>::SharedPtr behavior_tick_profile_service_ptr_;
+
 public:
   template <typename Node>
   auto getOrigin(Node & node) const
@@ -159,6 +244,34 @@ public:
     }
   }
 
+  /**
+   * @note The profiler is shared by all behavior plugins in the process, so it is reset for each
+   * scenario. While it is enabled, the profile is also served as JSON in the message of the
+   * response of the "behavior/tick_profile" service.
+   */
+  template <typename Node>
+  auto makeBehaviorTickProfileService(Node & node)
+    -> rclcpp::Service<std_srvs::srv::Trigger>::SharedPtr
+  {
+    auto & profiler = behavior::TickProfiler::get();
+    profiler.reset();
+    profiler.enable(
+      getParameter<bool>("profile_behavior_ticks", false) or
+      not behavior_tick_profile_path_.empty());
+    if (profiler.isEnabled()) {
+      return node->template create_service<std_srvs::srv::Trigger>(
+        "behavior/tick_profile",
+        [](
+          const std::shared_ptr<std_srvs::srv::Trigger::Request>,
+          std::shared_ptr<std_srvs::srv::Trigger::Response> response) {
+          response->success = true;
+          response->message = behavior::TickProfiler::get().toJson();
+        });
+    } else {
+      return nullptr;
+    }
+  }
+
   template <class NodeT, class AllocatorT = std::allocator<void>>
   explicit EntityManager(NodeT && node, const Configuration & configuration)
   : configuration(configuration),
@@ -194,12 +307,14 @@ public:
           clock_ptr_->now(), v2i_traffic_light_manager_ptr_->generateUpdateTrafficLightsRequest());
       }),
     conventional_traffic_light_updater_(
-      node, [this]() { conventional_traffic_light_marker_publisher_ptr_->publish(); })
+      node, [this]() { conventional_traffic_light_marker_publisher_ptr_->publish(); }),
+    behavior_tick_profile_path_(getParameter<std::string>("behavior_tick_profile_path", "")),
+    behavior_tick_profile_service_ptr_(makeBehaviorTickProfileService(node))
   {
     updateHdmapMarker();
   }
 
-  ~EntityManager() = default;
+  ~EntityManager();
 
 public:
 #define FORWARD_GETTER_TO_TRAFFIC_LIGHT_MANAGER(NAME)                 \
@@ -249,14 +364,19 @@ public:
 
 #undef FORWARD_TO_HDMAP_UTILS
 
-#define FORWARD_TO_ENTITY(IDENTIFIER, ...)                                     \
-  template <typename... Ts>                                                    \
-  decltype(auto) IDENTIFIER(const std::string & name, Ts &&... xs) __VA_ARGS__ \
-  try {                                                                        \
-    return entities_.at(name)->IDENTIFIER(std::forward<decltype(xs)>(xs)...);  \
-  } catch (const std::out_of_range &) {                                        \
-    THROW_SEMANTIC_ERROR("entity : ", name, "does not exist");                 \
-  }                                                                            \
+#define FORWARD_TO_ENTITY(IDENTIFIER, ...)                                        \
+  template <typename... Ts>                                                       \
+  decltype(auto) IDENTIFIER(const std::string & name, Ts &&... xs) __VA_ARGS__    \
+  try {                                                                           \
+    return entities_.at(name)->IDENTIFIER(std::forward<decltype(xs)>(xs)...);     \
+  } catch (const std::out_of_range &) {                                           \
+    THROW_SEMANTIC_ERROR("entity : ", name, "does not exist");                    \
+  }                                                                               \
+  template <typename... Ts>                                                       \
+  decltype(auto) IDENTIFIER(const EntityHandle & handle, Ts &&... xs) __VA_ARGS__ \
+  {                                                                               \
+    return resolve(handle).IDENTIFIER(std::forward<decltype(xs)>(xs)...);         \
+  }                                                                               \
   static_assert(true, "")
 
   FORWARD_TO_ENTITY(asFieldOperatorApplication, const);
@@ -288,6 +408,7 @@ public:
   FORWARD_TO_ENTITY(requestAssignRoute, );
   FORWARD_TO_ENTITY(requestFollowTrajectory, );
   FORWARD_TO_ENTITY(requestLaneChange, );
+  FORWARD_TO_ENTITY(requestReplayTrajectory, );
   FORWARD_TO_ENTITY(requestWalkStraight, );
   FORWARD_TO_ENTITY(activateOutOfRangeJob, );
   FORWARD_TO_ENTITY(setAccelerationLimit, );
@@ -302,6 +423,16 @@ public:
 
   visualization_msgs::msg::MarkerArray makeDebugMarker() const;
 
+  /**
+   * @brief Debug markers added or modified (ADD) and removed (DELETE) since the previous call.
+   * @param reset If true, returns a DELETEALL marker followed by all debug markers, for subscribers
+   * which have not received the previous markers.
+   */
+  auto makeDebugMarkerDifference(bool reset = false) -> visualization_msgs::msg::MarkerArray;
+
+  /// @note Whether the current frame is published, according to Configuration::publish_decimation.
+  auto isPublishingFrame() const noexcept { return publishing_frame_; }
+
   bool trafficLightsChanged();
 
   void requestSpeedChange(const std::string & name, double target_speed, bool continuous);
@@ -319,10 +450,7 @@ public:
     const speed_change::Transition transition, const speed_change::Constraint constraint,
     const bool continuous);
 
-  auto updateNpcLogic(
-    const std::string & name,
-    const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> & type_list)
-    -> const CanonicalizedEntityStatus &;
+  auto updateNpcLogic(const std::string & name) -> const CanonicalizedEntityStatus &;
 
   void broadcastEntityTransform();
 
@@ -331,13 +459,26 @@ public:
 
   bool checkCollision(const std::string & name0, const std::string & name1);
 
+  auto checkCollision(const EntityHandle &, const EntityHandle &) const -> bool;
+
+  /**
+   * @brief Names of the entities colliding with the given entity, found by the collision check of
+   * all entities done at the end of each update.
+   */
+  auto getCollidingEntities(const std::string & name) const -> std::vector<std::string>;
+
   bool despawnEntity(const std::string & name);
 
   bool entityExists(const std::string & name);
 
+  auto entityExists(const EntityHandle &) const noexcept -> bool;
+
   auto getBoundingBoxDistance(const std::string & from, const std::string & to)
     -> std::optional<double>;
 
+  auto getBoundingBoxDistance(const EntityHandle & from, const EntityHandle & to) const
+    -> std::optional<double>;
+
   auto getCurrentTime() const noexcept -> double;
 
   auto getDistanceToCrosswalk(const std::string & name, const std::int64_t target_crosswalk_id)
@@ -346,12 +487,22 @@ public:
   auto getDistanceToStopLine(const std::string & name, const std::int64_t target_stop_line_id)
     -> std::optional<double>;
 
+  /**
+   * @brief Handle of the entity, which stays valid until the entity is despawned. Resolve it once
+   * and pass it to the queries called every frame instead of the entity name.
+   */
+  auto getEntityHandle(const std::string & name) const -> EntityHandle;
+
   auto getEntityNames() const -> const std::vector<std::string>;
 
+  /// @note Names of the entities of the type, in spawned order.
+  auto getEntityNames(const traffic_simulator_msgs::msg::EntityType &) const
+    -> const std::vector<std::string> &;
+
   auto getEntityStatus(const std::string & name) const -> CanonicalizedEntityStatus;
 
   auto getEntityTypeList() const
-    -> const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>;
+    -> const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> &;
 
   auto getHdmapUtils() -> const std::shared_ptr<hdmap_utils::HdMapUtils> &;
 
@@ -385,6 +536,7 @@ public:
   auto getRelativePose(const CanonicalizedLaneletPose & from, const geometry_msgs::msg::Pose     & to) const -> geometry_msgs::msg::Pose;
   auto getRelativePose(const std::string                  & from, const CanonicalizedLaneletPose & to) const -> geometry_msgs::msg::Pose;
   auto getRelativePose(const CanonicalizedLaneletPose & from, const std::string                  & to) const -> geometry_msgs::msg::Pose;
+  auto getRelativePose(const EntityHandle             & from, const EntityHandle             & to) const -> geometry_msgs::msg::Pose;
   // clang-format on
 
   auto getStepTime() const noexcept -> double;
@@ -415,6 +567,8 @@ public:
 
   bool isEgo(const std::string & name) const;
 
+  auto isEgo(const EntityHandle &) const noexcept -> bool;
+
   bool isEgoSpawned() const;
 
   const std::string getEgoName() const;
@@ -450,10 +604,7 @@ public:
       EntityStatus entity_status;
 
       if constexpr (std::is_same_v<std::decay_t<Entity>, EgoEntity>) {
-        if (auto iter = std::find_if(
-              std::begin(entities_), std::end(entities_),
-              [this](auto && each) { return isEgo(each.first); });
-            iter != std::end(entities_)) {
+        if (ego_handle_) {
           THROW_SEMANTIC_ERROR("multi ego simulation does not support yet");
         } else {
           entity_status.type.type = traffic_simulator_msgs::msg::EntityType::EGO;
@@ -496,11 +647,32 @@ public:
       return CanonicalizedEntityStatus(entity_status, hdmap_utils_ptr_);
     };
 
-    if (const auto [iter, success] = entities_.emplace(
-          name, std::make_unique<Entity>(
-                  name, makeEntityStatus(), hdmap_utils_ptr_, parameters,
-                  std::forward<decltype(xs)>(xs)...));
-        success) {
+    auto makeEntity = [&]() {
+      if constexpr (
+        std::is_same_v<std::decay_t<Entity>, VehicleEntity> or
+        std::is_same_v<std::decay_t<Entity>, PedestrianEntity>) {
+        if constexpr (sizeof...(xs) == 0) {
+          return std::make_unique<Entity>(
+            name, makeEntityStatus(), hdmap_utils_ptr_, parameters,
+            Entity::BuiltinBehavior::defaultBehavior(), behavior_plugin_pool_);
+        } else {
+          return std::make_unique<Entity>(
+            name, makeEntityStatus(), hdmap_utils_ptr_, parameters,
+            std::forward<decltype(xs)>(xs)..., behavior_plugin_pool_);
+        }
+      } else if constexpr (std::is_same_v<std::decay_t<Entity>, EgoEntity>) {
+        return std::make_unique<Entity>(
+          name, makeEntityStatus(), hdmap_utils_ptr_, parameters,
+          std::forward<decltype(xs)>(xs)..., behavior_plugin_pool_);
+      } else {
+        return std::make_unique<Entity>(
+          name, makeEntityStatus(), hdmap_utils_ptr_, parameters,
+          std::forward<decltype(xs)>(xs)...);
+      }
+    };
+
+    if (const auto [iter, success] = entities_.emplace(name, makeEntity()); success) {
+      registerEntity(*iter->second);
       // FIXME: this ignores V2I traffic lights
       iter->second->setTrafficLightManager(conventional_traffic_light_manager_ptr_);
       if (npc_logic_started_ && not isEgo(name)) {
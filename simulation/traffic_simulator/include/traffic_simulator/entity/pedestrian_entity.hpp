@@ -17,10 +17,10 @@
 
 #include <memory>
 #include <optional>
-#include <pluginlib/class_loader.hpp>
 #include <pugixml.hpp>
 #include <string>
 #include <traffic_simulator/behavior/behavior_plugin_base.hpp>
+#include <traffic_simulator/behavior/behavior_plugin_pool.hpp>
 #include <traffic_simulator/behavior/route_planner.hpp>
 #include <traffic_simulator/entity/entity_base.hpp>
 #include <traffic_simulator_msgs/msg/pedestrian_parameters.hpp>
@@ -60,7 +60,7 @@ public:
     const std::string & name, const CanonicalizedEntityStatus &,
     const std::shared_ptr<hdmap_utils::HdMapUtils> &,
     const traffic_simulator_msgs::msg::PedestrianParameters &,
-    const std::string & plugin_name = BuiltinBehavior::defaultBehavior());
+    const std::string & plugin_name, const std::shared_ptr<BehaviorPluginPool> &);
 
   ~PedestrianEntity() override = default;
 
@@ -76,6 +76,9 @@ public:
 
   void requestAcquirePosition(const geometry_msgs::msg::Pose & map_pose) override;
 
+  auto requestReplayTrajectory(const std::shared_ptr<const replay_trajectory::Trajectory> &)
+    -> void override;
+
   void requestWalkStraight() override;
 
   void cancelRequest() override;
@@ -106,6 +109,11 @@ public:
 
   auto getRouteLanelets(double horizon = 100) -> std::vector<std::int64_t> override;
 
+  auto getRouteCacheStatistics() const noexcept -> const CacheStatistics &
+  {
+    return route_planner_.getCacheStatistics();
+  }
+
   auto getObstacle() -> std::optional<traffic_simulator_msgs::msg::Obstacle> override;
 
   auto getGoalPoses() -> std::vector<CanonicalizedLaneletPose> override;
@@ -117,9 +125,11 @@ public:
   const std::string plugin_name;
 
 private:
-  pluginlib::ClassLoader<entity_behavior::BehaviorPluginBase> loader_;
   const std::shared_ptr<entity_behavior::BehaviorPluginBase> behavior_plugin_ptr_;
   traffic_simulator::RoutePlanner route_planner_;
+  /// @note The entity type list last given to the behavior plugin, which keeps it until replaced.
+  std::shared_ptr<const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>>
+    behavior_plugin_entity_type_list_;
 };
 }  // namespace entity
 }  // namespace traffic_simulator
@@ -17,11 +17,11 @@
 
 #include <memory>
 #include <optional>
-#include <pluginlib/class_loader.hpp>
 #include <pugixml.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <string>
 #include <traffic_simulator/behavior/behavior_plugin_base.hpp>
+#include <traffic_simulator/behavior/behavior_plugin_pool.hpp>
 #include <traffic_simulator/behavior/route_planner.hpp>
 #include <traffic_simulator/entity/entity_base.hpp>
 #include <traffic_simulator_msgs/msg/behavior_parameter.hpp>
@@ -56,6 +56,13 @@ public:
       return name;
     }
 
+    static auto intelligentDriverModel() noexcept -> const std::string &
+    {
+      static const std::string name =
+        "intelligent_driver_model_plugin/IntelligentDriverModelPlugin";
+      return name;
+    }
+
     static auto defaultBehavior() -> const std::string & { return behaviorTree(); }
   };
 
@@ -63,7 +70,7 @@ public:
     const std::string & name, const CanonicalizedEntityStatus &,
     const std::shared_ptr<hdmap_utils::HdMapUtils> &,
     const traffic_simulator_msgs::msg::VehicleParameters &,
-    const std::string & plugin_name = BuiltinBehavior::defaultBehavior());
+    const std::string & plugin_name, const std::shared_ptr<BehaviorPluginPool> &);
 
   ~VehicleEntity() override = default;
 
@@ -88,6 +95,17 @@ public:
 
   auto getRouteLanelets(double horizon = 100) -> std::vector<std::int64_t> override;
 
+  auto getRouteCacheStatistics() const noexcept -> const CacheStatistics &
+  {
+    return route_planner_.getCacheStatistics();
+  }
+
+  /// @note A miss rebuilds the reference trajectory, reusing the curves shared with the last one.
+  auto getReferenceTrajectoryCacheStatistics() const noexcept -> const CacheStatistics &
+  {
+    return reference_trajectory_cache_statistics_;
+  }
+
   auto getWaypoints() -> const traffic_simulator_msgs::msg::WaypointsArray override;
 
   void onUpdate(double current_time, double step_time) override;
@@ -103,6 +121,9 @@ public:
   auto requestFollowTrajectory(
     const std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory> &) -> void override;
 
+  auto requestReplayTrajectory(const std::shared_ptr<const replay_trajectory::Trajectory> &)
+    -> void override;
+
   void requestLaneChange(const std::int64_t to_lanelet_id) override;
 
   void requestLaneChange(const traffic_simulator::lane_change::Parameter &) override;
@@ -123,8 +144,6 @@ public:
   auto fillLaneletPose(CanonicalizedEntityStatus & status) -> void override;
 
 private:
-  pluginlib::ClassLoader<entity_behavior::BehaviorPluginBase> loader_;
-
   const std::shared_ptr<entity_behavior::BehaviorPluginBase> behavior_plugin_ptr_;
 
   traffic_simulator::RoutePlanner route_planner_;
@@ -132,6 +151,12 @@ private:
   std::shared_ptr<math::geometry::CatmullRomSpline> spline_;
 
   std::vector<std::int64_t> previous_route_lanelets_;
+
+  CacheStatistics reference_trajectory_cache_statistics_;
+
+  /// @note The entity type list last given to the behavior plugin, which keeps it until replaced.
+  std::shared_ptr<const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>>
+    behavior_plugin_entity_type_list_;
 };
 }  // namespace entity
 }  // namespace traffic_simulator
@@ -17,6 +17,7 @@
 
 #include <geometry/spline/catmull_rom_spline.hpp>
 #include <geometry_msgs/msg/point.hpp>
+#include <memory>
 #include <mutex>
 #include <optional>
 #include <scenario_simulator_exception/exception.hpp>
@@ -100,6 +101,38 @@ private:
   std::mutex mutex_;
 };
 
+class CenterlineSamplesCache
+{
+public:
+  bool exists(std::int64_t lanelet_id)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (data_.find(lanelet_id) == data_.end()) {
+      return false;
+    }
+    return true;
+  }
+  std::shared_ptr<const std::vector<geometry_msgs::msg::Point>> getSamples(std::int64_t lanelet_id)
+  {
+    if (!exists(lanelet_id)) {
+      THROW_SIMULATION_ERROR(
+        "centerline samples of : ", lanelet_id, " does not exists on centerline samples cache.");
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    return data_.at(lanelet_id);
+  }
+  void appendData(std::int64_t lanelet_id, const std::vector<geometry_msgs::msg::Point> & samples)
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    data_[lanelet_id] = std::make_shared<const std::vector<geometry_msgs::msg::Point>>(samples);
+  }
+
+private:
+  std::unordered_map<std::int64_t, std::shared_ptr<const std::vector<geometry_msgs::msg::Point>>>
+    data_;
+  std::mutex mutex_;
+};
+
 class LaneletLengthCache
 {
 public:
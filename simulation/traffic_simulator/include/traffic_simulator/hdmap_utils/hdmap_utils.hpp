@@ -50,6 +50,7 @@
 #include <string>
 #include <traffic_simulator/data_type/lane_change.hpp>
 #include <traffic_simulator/hdmap_utils/cache.hpp>
+#include <traffic_simulator/hdmap_utils/polyline_view.hpp>
 #include <traffic_simulator_msgs/msg/bounding_box.hpp>
 #include <traffic_simulator_msgs/msg/entity_status.hpp>
 #include <tuple>
@@ -64,6 +65,8 @@ enum class LaneletType { LANE, CROSSWALK };
 
 class HdMapUtils
 {
+  friend class HdMapUtilsTest;
+
 public:
   explicit HdMapUtils(const boost::filesystem::path &, const geographic_msgs::msg::GeoPoint &);
 
@@ -103,6 +106,21 @@ public:
   std::optional<std::int64_t> matchToLane(
     const geometry_msgs::msg::Pose & pose, const traffic_simulator_msgs::msg::BoundingBox & bbox,
     bool include_crosswalk, double reduction_ratio = 0.8) const;
+  /**
+   * @brief Batched versions of toLaneletPose/matchToLane.
+   * Entities are processed in Morton (Z-order) of their positions and neighbouring entities share
+   * one R-tree query for their lane matching candidates. The i-th result is equal to the result of
+   * the scalar function called with poses[i] and bboxes[i].
+   * @param thread_count number of worker threads, 1 processes the batch on the caller thread.
+   */
+  std::vector<std::optional<traffic_simulator_msgs::msg::LaneletPose>> toLaneletPose(
+    const std::vector<geometry_msgs::msg::Pose> & poses,
+    const std::vector<traffic_simulator_msgs::msg::BoundingBox> & bboxes, bool include_crosswalk,
+    double matching_distance = 1.0, std::size_t thread_count = 1) const;
+  std::vector<std::optional<std::int64_t>> matchToLane(
+    const std::vector<geometry_msgs::msg::Pose> & poses,
+    const std::vector<traffic_simulator_msgs::msg::BoundingBox> & bboxes, bool include_crosswalk,
+    double reduction_ratio = 0.8, std::size_t thread_count = 1) const;
   geometry_msgs::msg::PoseStamped toMapPose(
     const traffic_simulator_msgs::msg::LaneletPose & lanelet_pose) const;
   double getHeight(const traffic_simulator_msgs::msg::LaneletPose & lanelet_pose) const;
@@ -156,6 +174,13 @@ public:
   std::vector<geometry_msgs::msg::Point> clipTrajectoryFromLaneletIds(
     std::int64_t lanelet_id, double s, const std::vector<std::int64_t> & lanelet_ids,
     double forward_distance = 20) const;
+  /**
+   * @brief Same points as clipTrajectoryFromLaneletIds, without copying the cached samples of
+   * the lanelets following lanelet_id.
+   */
+  PolylineView clipTrajectoryViewFromLaneletIds(
+    std::int64_t lanelet_id, double s, const std::vector<std::int64_t> & lanelet_ids,
+    double forward_distance = 20) const;
   bool canChangeLane(std::int64_t from_lanelet_id, std::int64_t to_lanelet_id) const;
   std::optional<std::pair<math::geometry::HermiteCurve, double>> getLaneChangeTrajectory(
     const traffic_simulator_msgs::msg::LaneletPose & from_pose,
@@ -246,7 +271,40 @@ private:
   mutable RouteCache route_cache_;
   mutable CenterPointsCache center_points_cache_;
   mutable LaneletLengthCache lanelet_length_cache_;
+  mutable CenterlineSamplesCache centerline_samples_cache_;
+  // @}
+
+  /** @defgroup index
+   *  Traffic light and stop line indexes, built once when the map is loaded
+   */
+  // @{
+  std::vector<std::int64_t> traffic_light_ids_;
+  std::unordered_map<std::int64_t, std::vector<lanelet::AutowareTrafficLightConstPtr>>
+    traffic_lights_;
+  std::unordered_map<std::int64_t, std::unordered_map<std::string, geometry_msgs::msg::Point>>
+    traffic_light_bulb_positions_;
+  std::unordered_map<std::int64_t, std::vector<std::vector<geometry_msgs::msg::Point>>>
+    traffic_light_stop_lines_points_;
+  std::unordered_map<LaneletId, std::vector<LaneletId>> traffic_light_regulatory_element_ids_;
+  std::unordered_map<std::int64_t, std::vector<std::int64_t>> traffic_light_ids_on_lanelet_;
+  std::unordered_map<std::int64_t, std::vector<lanelet::ConstLineString3d>> stop_lines_on_lanelet_;
   // @}
+  void buildTrafficLightAndStopLineIndex();
+
+  /** @defgroup conflict
+   *  Conflicting lanes and crosswalks of each lanelet, built once when the map is loaded
+   */
+  // @{
+  std::unordered_map<std::int64_t, std::vector<std::int64_t>> conflicting_lane_ids_;
+  std::unordered_map<std::int64_t, std::vector<std::int64_t>> conflicting_crosswalk_ids_;
+  std::unordered_map<std::pair<std::int64_t, std::int64_t>, std::optional<double>>
+    collision_points_in_lane_coordinate_;
+  // @}
+  void buildConflictTable();
+  std::vector<std::int64_t> calculateConflictingLaneIds(std::int64_t lanelet_id) const;
+  std::vector<std::int64_t> calculateConflictingCrosswalkIds(std::int64_t lanelet_id) const;
+  std::optional<double> calculateCollisionPointInLaneCoordinate(
+    std::int64_t lanelet_id, std::int64_t crossing_lanelet_id) const;
 
   template <typename Lanelet>
   std::vector<std::int64_t> getLaneletIds(const std::vector<Lanelet> & lanelets) const
@@ -263,10 +321,8 @@ private:
     const std::vector<std::pair<double, lanelet::Lanelet>> & lls, const char subtype[]) const;
   std::vector<lanelet::Lanelet> filterLanelets(
     const std::vector<lanelet::Lanelet> & lanelets, const char subtype[]) const;
-  std::vector<std::shared_ptr<const lanelet::autoware::AutowareTrafficLight>>
-  getTrafficLightRegElementsOnPath(const std::vector<std::int64_t> & lanelet_ids) const;
-  std::vector<std::shared_ptr<const lanelet::TrafficSign>> getTrafficSignRegElementsOnPath(
-    const std::vector<std::int64_t> & lanelet_ids) const;
+  std::shared_ptr<const std::vector<geometry_msgs::msg::Point>> getCenterlineSamples(
+    std::int64_t lanelet_id) const;
   std::vector<lanelet::ConstLineString3d> getStopLinesOnPath(
     const std::vector<std::int64_t> & lanelet_ids) const;
   geometry_msgs::msg::Vector3 getVectorFromPose(
@@ -277,6 +333,7 @@ private:
   lanelet::traffic_rules::TrafficRulesPtr traffic_rules_vehicle_ptr_;
   lanelet::routing::RoutingGraphConstPtr pedestrian_routing_graph_ptr_;
   lanelet::traffic_rules::TrafficRulesPtr traffic_rules_pedestrian_ptr_;
+  std::shared_ptr<const lanelet::routing::RoutingGraphContainer> routing_graph_container_ptr_;
   std::vector<double> calcEuclidDist(
     const std::vector<double> & x, const std::vector<double> & y,
     const std::vector<double> & z) const;
@@ -295,6 +352,20 @@ private:
   lanelet::BasicPoint2d toPoint2d(const geometry_msgs::msg::Point & point) const;
   lanelet::BasicPolygon2d absoluteHull(
     const lanelet::BasicPolygon2d & relativeHull, const lanelet::matching::Pose2d & pose) const;
+  lanelet::matching::Object2d toObject2d(
+    const geometry_msgs::msg::Pose & pose, const traffic_simulator_msgs::msg::BoundingBox & bbox,
+    double reduction_ratio) const;
+  std::optional<std::int64_t> matchToLane(
+    const geometry_msgs::msg::Pose & pose, std::vector<lanelet::matching::LaneletMatch> matches,
+    bool include_crosswalk) const;
+  std::optional<traffic_simulator_msgs::msg::LaneletPose> toLaneletPoseFromMatchedLanelet(
+    const geometry_msgs::msg::Pose & pose, const std::optional<std::int64_t> & lanelet_id,
+    bool include_crosswalk, double matching_distance) const;
+  template <typename Function>
+  void forEachLaneMatchingCandidates(
+    const std::vector<geometry_msgs::msg::Pose> & poses,
+    const std::vector<traffic_simulator_msgs::msg::BoundingBox> & bboxes, double reduction_ratio,
+    std::size_t thread_count, Function && function) const;
   std::vector<geometry_msgs::msg::Point> toPolygon(
     const lanelet::ConstLineString3d & line_string) const;
   lanelet::ConstLanelets shoulder_lanelets_;
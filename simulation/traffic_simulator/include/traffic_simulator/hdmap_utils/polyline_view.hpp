@@ -0,0 +1,89 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__HDMAP_UTILS__POLYLINE_VIEW_HPP_
+#define TRAFFIC_SIMULATOR__HDMAP_UTILS__POLYLINE_VIEW_HPP_
+
+#include <geometry_msgs/msg/point.hpp>
+#include <memory>
+#include <scenario_simulator_exception/exception.hpp>
+#include <utility>
+#include <vector>
+
+namespace hdmap_utils
+{
+/**
+ * @brief Read-only polyline made of prefixes of shared point arrays.
+ * Points are not copied, so the view is cheap to build from cached per-lanelet samples.
+ */
+class PolylineView
+{
+public:
+  using Points = std::vector<geometry_msgs::msg::Point>;
+
+  void append(const std::shared_ptr<const Points> & points, std::size_t size)
+  {
+    if (size > points->size()) {
+      THROW_SIMULATION_ERROR(
+        "size of the segment (", size, ") exceeds the number of points (", points->size(), ").");
+    }
+    if (size != 0) {
+      segments_.emplace_back(points, size);
+      size_ += size;
+    }
+  }
+
+  auto size() const noexcept -> std::size_t { return size_; }
+
+  auto empty() const noexcept -> bool { return size_ == 0; }
+
+  auto operator[](std::size_t index) const -> const geometry_msgs::msg::Point &
+  {
+    for (const auto & [points, size] : segments_) {
+      if (index < size) {
+        return (*points)[index];
+      }
+      index -= size;
+    }
+    THROW_SIMULATION_ERROR("index ", index, " is out of range of the polyline view.");
+  }
+
+  template <typename Function>
+  auto forEach(Function && function) const -> void
+  {
+    for (const auto & [points, size] : segments_) {
+      for (std::size_t i = 0; i < size; ++i) {
+        function((*points)[i]);
+      }
+    }
+  }
+
+  auto toVector() const -> Points
+  {
+    Points ret;
+    ret.reserve(size_);
+    for (const auto & [points, size] : segments_) {
+      ret.insert(ret.end(), points->begin(), points->begin() + size);
+    }
+    return ret;
+  }
+
+private:
+  std::vector<std::pair<std::shared_ptr<const Points>, std::size_t>> segments_;
+
+  std::size_t size_ = 0;
+};
+}  // namespace hdmap_utils
+
+#endif  // TRAFFIC_SIMULATOR__HDMAP_UTILS__POLYLINE_VIEW_HPP_
@@ -0,0 +1,131 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__JOB__INPLACE_FUNCTION_HPP_
+#define TRAFFIC_SIMULATOR__JOB__INPLACE_FUNCTION_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace traffic_simulator
+{
+namespace job
+{
+template <typename Signature, std::size_t Capacity = 96>
+class InplaceFunction;
+
+/**
+ * @brief Move-only std::function alternative which always stores the callable in a fixed size
+ * buffer, so that constructing a job never allocates. Callables which do not fit are rejected at
+ * compile time.
+ */
+template <typename Result, typename... Arguments, std::size_t Capacity>
+class InplaceFunction<Result(Arguments...), Capacity>
+{
+  struct VirtualTable
+  {
+    Result (*invoke)(void *, Arguments...);
+    void (*move)(void * destination, void * source) noexcept;
+    void (*destroy)(void *) noexcept;
+  };
+
+  template <typename Callable>
+  static constexpr VirtualTable virtual_table = {
+    [](void * callable, Arguments... arguments) -> Result {
+      return std::invoke(
+        *static_cast<Callable *>(callable), std::forward<Arguments>(arguments)...);
+    },
+    [](void * destination, void * source) noexcept {
+      new (destination) Callable(std::move(*static_cast<Callable *>(source)));
+      static_cast<Callable *>(source)->~Callable();
+    },
+    [](void * callable) noexcept { static_cast<Callable *>(callable)->~Callable(); }};
+
+public:
+  InplaceFunction() noexcept = default;
+
+  template <
+    typename Function,
+    typename = std::enable_if_t<not std::is_same_v<std::decay_t<Function>, InplaceFunction>>>
+  InplaceFunction(Function && function)  // NOLINT(google-explicit-constructor)
+  : virtual_table_(&virtual_table<std::decay_t<Function>>)
+  {
+    using Callable = std::decay_t<Function>;
+    static_assert(
+      sizeof(Callable) <= Capacity, "The callable is too large for the InplaceFunction buffer.");
+    static_assert(
+      alignof(Callable) <= alignof(std::max_align_t), "The callable is over-aligned.");
+    static_assert(
+      std::is_nothrow_move_constructible_v<Callable>,
+      "The callable must be nothrow move constructible.");
+    new (storage_) Callable(std::forward<Function>(function));
+  }
+
+  InplaceFunction(InplaceFunction && other) noexcept : virtual_table_(other.virtual_table_)
+  {
+    if (virtual_table_) {
+      virtual_table_->move(storage_, other.storage_);
+      other.virtual_table_ = nullptr;
+    }
+  }
+
+  InplaceFunction(const InplaceFunction &) = delete;
+
+  auto operator=(InplaceFunction && other) noexcept -> InplaceFunction &
+  {
+    if (this != &other) {
+      reset();
+      virtual_table_ = other.virtual_table_;
+      if (virtual_table_) {
+        virtual_table_->move(storage_, other.storage_);
+        other.virtual_table_ = nullptr;
+      }
+    }
+    return *this;
+  }
+
+  auto operator=(const InplaceFunction &) -> InplaceFunction & = delete;
+
+  ~InplaceFunction() { reset(); }
+
+  auto operator()(Arguments... arguments) const -> Result
+  {
+    if (not virtual_table_) {
+      throw std::bad_function_call();
+    }
+    return virtual_table_->invoke(storage_, std::forward<Arguments>(arguments)...);
+  }
+
+  explicit operator bool() const noexcept { return virtual_table_ != nullptr; }
+
+private:
+  auto reset() noexcept -> void
+  {
+    if (virtual_table_) {
+      virtual_table_->destroy(storage_);
+      virtual_table_ = nullptr;
+    }
+  }
+
+  const VirtualTable * virtual_table_ = nullptr;
+
+  alignas(std::max_align_t) mutable unsigned char storage_[Capacity];
+};
+}  // namespace job
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__JOB__INPLACE_FUNCTION_HPP_
@@ -15,8 +15,8 @@
 #ifndef TRAFFIC_SIMULATOR__JOB__JOB_HPP_
 #define TRAFFIC_SIMULATOR__JOB__JOB_HPP_
 
-#include <functional>
 #include <memory>
+#include <traffic_simulator/job/inplace_function.hpp>
 
 namespace traffic_simulator
 {
@@ -53,15 +53,15 @@ public:
    * @param exclusive If true, the Job works exclusively by type.
    */
   Job(
-    const std::function<bool(double)> & func_on_update,
-    const std::function<void()> & func_on_cleanup, job::Type type, bool exclusive, Event event);
+    InplaceFunction<bool(double)> func_on_update, InplaceFunction<void()> func_on_cleanup,
+    job::Type type, bool exclusive, Event event);
   void onUpdate(const double step_time);
   void inactivate();
   Status getStatus() const;
 
 private:
-  std::function<bool(double)> func_on_update_;
-  std::function<void()> func_on_cleanup_;
+  InplaceFunction<bool(double)> func_on_update_;
+  InplaceFunction<void()> func_on_cleanup_;
   Status status_;
   double job_duration_;
 
@@ -15,24 +15,40 @@
 #ifndef TRAFFIC_SIMULATOR__JOB__JOB_LIST_HPP_
 #define TRAFFIC_SIMULATOR__JOB__JOB_LIST_HPP_
 
+#include <array>
+#include <cstddef>
+#include <optional>
 #include <traffic_simulator/job/job.hpp>
-#include <vector>
 
 namespace traffic_simulator
 {
 namespace job
 {
+/**
+ * @brief Jobs of an entity. Appending a job inactivates and replaces the active job with the same
+ * type and exclusivity, and finished jobs are erased on update, so there is at most one job per
+ * slot and the list never grows with the number of requests.
+ * @note Jobs must not append jobs from their own callbacks.
+ */
 class JobList
 {
 public:
   void append(
-    const std::function<bool(const double)> & func_on_update,
-    const std::function<void()> & func_on_cleanup, job::Type type, bool exclusive,
-    const job::Event event);
+    InplaceFunction<bool(double)> func_on_update, InplaceFunction<void()> func_on_cleanup,
+    job::Type type, bool exclusive, const job::Event event);
   void update(const double step_time, const job::Event event);
 
+  /// @note Number of jobs which have not finished yet.
+  auto size() const -> std::size_t;
+
 private:
-  std::vector<Job> list_;
+  static constexpr std::size_t number_of_types =
+    static_cast<std::size_t>(job::Type::OUT_OF_RANGE) + 1;
+
+  static auto slot(job::Type type, bool exclusive) -> std::size_t;
+
+  /// @note Jobs are updated in the order of their type rather than the order of appending.
+  std::array<std::optional<Job>, number_of_types * 2> list_;
 };
 }  // namespace job
 }  // namespace traffic_simulator
@@ -30,6 +30,8 @@
 #include <string>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
 #include <traffic_simulator/traffic/traffic_module_base.hpp>
+#include <traffic_simulator/traffic/traffic_sink.hpp>
+#include <traffic_simulator/traffic/traffic_sink_index.hpp>
 #include <utility>
 #include <vector>
 
@@ -57,6 +59,12 @@ private:
   void autoSink();
   const std::shared_ptr<hdmap_utils::HdMapUtils> hdmap_utils_;
   std::vector<std::shared_ptr<traffic_simulator::traffic::TrafficModuleBase>> modules_;
+  /**
+   * @note Sinks added by autoSink are not executed one by one. Instead, the controller looks up
+   * each entity in this index once per frame and despawns the entities inside any of them together.
+   * Sinks added by addModule are executed as the other modules with their own functions.
+   */
+  TrafficSinkIndex auto_sinks_;
   const std::function<std::vector<std::string>(void)> get_entity_names_function;
   const std::function<geometry_msgs::msg::Pose(const std::string &)> get_entity_pose_function;
   const std::function<void(const std::string &)> despawn_function;
@@ -47,6 +47,11 @@ public:
   const double radius;
   const geometry_msgs::msg::Point position;
   void execute() override;
+  /**
+   * @brief Whether an entity at the pose is despawned by this sink.
+   * @note The distance is measured in 3D.
+   */
+  auto isInside(const geometry_msgs::msg::Pose & pose) const -> bool;
 
 private:
   const std::function<std::vector<std::string>(void)> get_entity_names_function;
@@ -0,0 +1,61 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__TRAFFIC__TRAFFIC_SINK_INDEX_HPP_
+#define TRAFFIC_SIMULATOR__TRAFFIC__TRAFFIC_SINK_INDEX_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <geometry_msgs/msg/pose.hpp>
+#include <memory>
+#include <traffic_simulator/traffic/traffic_sink.hpp>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace traffic_simulator
+{
+namespace traffic
+{
+/**
+ * @brief Traffic sinks indexed by a uniform grid over their ranges, so that TrafficController
+ * finds the sinks containing an entity by looking up only the grid cell of the entity.
+ */
+class TrafficSinkIndex
+{
+public:
+  auto insert(const std::shared_ptr<TrafficSink> & sink) -> void;
+
+  /// @note Whether the pose is inside the range of any sink, in the same way as TrafficSink.
+  auto contains(const geometry_msgs::msg::Pose & pose) const -> bool;
+
+  auto empty() const noexcept { return sinks_.empty(); }
+
+  auto size() const noexcept { return sinks_.size(); }
+
+  static constexpr double grid_cell_size = 10.0;
+
+private:
+  static auto toGridCell(double x, double y) -> std::pair<std::int64_t, std::int64_t>;
+
+  static auto toGridKey(std::int64_t cell_x, std::int64_t cell_y) -> std::int64_t;
+
+  std::vector<std::shared_ptr<TrafficSink>> sinks_;
+
+  std::unordered_map<std::int64_t, std::vector<std::size_t>> grid_;
+};
+}  // namespace traffic
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__TRAFFIC__TRAFFIC_SINK_INDEX_HPP_
@@ -0,0 +1,98 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__TRAFFIC__TRAFFIC_SOURCE_HPP_
+#define TRAFFIC_SIMULATOR__TRAFFIC__TRAFFIC_SOURCE_HPP_
+
+#include <cstddef>
+#include <functional>
+#include <geometry_msgs/msg/point.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+#include <limits>
+#include <random>
+#include <string>
+#include <traffic_simulator/data_type/lanelet_pose.hpp>
+#include <traffic_simulator/traffic/traffic_module_base.hpp>
+#include <utility>
+#include <vector>
+
+namespace traffic_simulator
+{
+namespace traffic
+{
+/**
+ * @brief Spawns entities at the given spawn poses continuously. Each arrival picks one of the spawn
+ * poses at random, and is skipped if the spawn pose is not clear or the region around the source is
+ * already full.
+ */
+class TrafficSource : public TrafficModuleBase
+{
+public:
+  enum class Arrival {
+    FIXED_RATE,
+    POISSON,
+  };
+
+  struct Configuration
+  {
+    /// @note Mean number of arrivals per second.
+    double rate = 1.0;
+
+    Arrival arrival = Arrival::POISSON;
+
+    /// @note Minimum distance between a spawn pose and any entity for the arrival to be spawned.
+    double clearance = 10.0;
+
+    /// @note The region is the circle of region_radius around the mean position of spawn poses.
+    double region_radius = 100.0;
+
+    std::size_t maximum_number_of_entities_in_region = std::numeric_limits<std::size_t>::max();
+
+    std::mt19937::result_type seed = 0;
+  };
+
+  explicit TrafficSource(
+    const std::string & name, const std::vector<CanonicalizedLaneletPose> & spawn_poses,
+    const Configuration & configuration,
+    const std::function<std::vector<std::string>(void)> & get_entity_names_function,
+    const std::function<geometry_msgs::msg::Pose(const std::string &)> & get_entity_pose_function,
+    const std::function<void(const std::string &, const CanonicalizedLaneletPose &)> &
+      spawn_function,
+    const std::function<double(void)> & get_current_time_function);
+  const std::string name;
+  const Configuration configuration;
+  void execute() override;
+  auto getNumberOfSpawnedEntities() const noexcept { return number_of_spawned_entities_; }
+
+private:
+  auto makeInterval() -> double;
+  auto isSpawnable(
+    const geometry_msgs::msg::Point & spawn_position,
+    const std::vector<geometry_msgs::msg::Point> & entity_positions) const -> bool;
+  const std::function<std::vector<std::string>(void)> get_entity_names_function;
+  const std::function<geometry_msgs::msg::Pose(const std::string &)> get_entity_pose_function;
+  const std::function<void(const std::string &, const CanonicalizedLaneletPose &)> spawn_function;
+  const std::function<double(void)> get_current_time_function;
+  const std::vector<CanonicalizedLaneletPose> spawn_poses_;
+  const geometry_msgs::msg::Point region_center_;
+  std::mt19937 engine_;
+  double next_arrival_time_ = std::numeric_limits<double>::quiet_NaN();
+  std::size_t number_of_spawned_entities_ = 0;
+  /// @note Number of the next entity name, which skips the names of the existing entities.
+  std::size_t next_entity_number_ = 0;
+};
+}  // namespace traffic
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__TRAFFIC__TRAFFIC_SOURCE_HPP_
@@ -22,6 +22,7 @@
 #include <stdexcept>
 #include <string>
 #include <traffic_simulator/api/api.hpp>
+#include <utility>
 
 namespace traffic_simulator
 {
@@ -275,7 +276,15 @@ bool API::updateFrame()
   entity_manager_ptr_->broadcastEntityTransform();
   clock_.update();
   clock_pub_->publish(clock_.getCurrentRosTimeAsMsg());
-  debug_marker_pub_->publish(entity_manager_ptr_->makeDebugMarker());
+  if (const auto subscription_count = debug_marker_pub_->get_subscription_count();
+      subscription_count != debug_marker_subscription_count_) {
+    debug_marker_subscription_count_ = subscription_count;
+    debug_marker_reset_ = true;
+  }
+  if (debug_marker_subscription_count_ > 0 and entity_manager_ptr_->isPublishingFrame()) {
+    debug_marker_pub_->publish(
+      entity_manager_ptr_->makeDebugMarkerDifference(std::exchange(debug_marker_reset_, false)));
+  }
   return true;
 }
 
@@ -303,6 +312,13 @@ auto API::requestFollowTrajectory(
   }
 }
 
+auto API::requestReplayTrajectory(
+  const std::string & name, const std::shared_ptr<const replay_trajectory::Trajectory> & trajectory)
+  -> void
+{
+  entity_manager_ptr_->requestReplayTrajectory(name, trajectory);
+}
+
 void API::requestLaneChange(const std::string & name, const std::int64_t & lanelet_id)
 {
   entity_manager_ptr_->requestLaneChange(name, lanelet_id);
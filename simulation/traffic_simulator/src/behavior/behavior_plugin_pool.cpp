@@ -0,0 +1,66 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+#include <traffic_simulator/behavior/behavior_plugin_pool.hpp>
+#include <utility>
+
+namespace traffic_simulator
+{
+BehaviorPluginPool::BehaviorPluginPool()
+: loader_("traffic_simulator", "entity_behavior::BehaviorPluginBase")
+{
+}
+
+auto BehaviorPluginPool::acquire(const std::string & plugin_name, const rclcpp::Logger & logger)
+  -> std::shared_ptr<entity_behavior::BehaviorPluginBase>
+{
+  auto plugin = [&]() -> std::shared_ptr<entity_behavior::BehaviorPluginBase> {
+    if (auto iter = idle_plugins_.find(plugin_name); iter != idle_plugins_.end()) {
+      while (not iter->second.empty()) {
+        auto idle_plugin = std::move(iter->second.back());
+        iter->second.pop_back();
+        if (idle_plugin->reset(logger)) {
+          return idle_plugin;
+        }
+      }
+    }
+    auto new_plugin = loader_.createSharedInstance(plugin_name);
+    new_plugin->configure(logger);
+    return new_plugin;
+  }();
+  /**
+   * @note The returned pointer shares nothing with plugin but the pointee; its deleter keeps the
+   * pool alive and returns plugin to the idle list instead of destroying it.
+   */
+  return std::shared_ptr<entity_behavior::BehaviorPluginBase>(
+    plugin.get(), [pool = shared_from_this(), plugin_name, plugin](auto *) mutable {
+      try {
+        pool->idle_plugins_[plugin_name].push_back(std::move(plugin));
+      } catch (...) {
+        plugin.reset();
+      }
+    });
+}
+
+auto BehaviorPluginPool::size(const std::string & plugin_name) const -> std::size_t
+{
+  if (const auto iter = idle_plugins_.find(plugin_name); iter != idle_plugins_.end()) {
+    return iter->second.size();
+  } else {
+    return 0;
+  }
+}
+}  // namespace traffic_simulator
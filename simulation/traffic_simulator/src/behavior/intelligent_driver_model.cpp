@@ -0,0 +1,177 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <traffic_simulator/behavior/intelligent_driver_model.hpp>
+
+namespace traffic_simulator
+{
+namespace intelligent_driver_model
+{
+namespace
+{
+/// @note Distance from the origin of the entity to the front and to the rear of its bounding box.
+auto getFrontLength(const traffic_simulator_msgs::msg::BoundingBox & bounding_box)
+{
+  return bounding_box.center.x + bounding_box.dimensions.x / 2.0;
+}
+
+auto getRearLength(const traffic_simulator_msgs::msg::BoundingBox & bounding_box)
+{
+  return bounding_box.dimensions.x / 2.0 - bounding_box.center.x;
+}
+}  // namespace
+
+auto makeLane(
+  const hdmap_utils::HdMapUtils & hdmap_utils,
+  const std::vector<std::int64_t> & following_lanelet_ids, const Parameter & parameter) -> Lane
+{
+  Lane lane;
+  if (following_lanelet_ids.empty()) {
+    return lane;
+  }
+  /// @note getPreviousLanelets returns the lanelets in reverse driving direction, including itself.
+  const auto previous_lanelet_ids =
+    hdmap_utils.getPreviousLanelets(following_lanelet_ids.front(), parameter.backward_distance);
+  double offset = 0.0;
+  for (auto iter = std::next(previous_lanelet_ids.begin()); iter != previous_lanelet_ids.end();
+       ++iter) {
+    offset -= hdmap_utils.getLaneletLength(*iter);
+    lane.lanelet_ids.push_back(*iter);
+    lane.offsets.push_back(offset);
+  }
+  std::reverse(lane.lanelet_ids.begin(), lane.lanelet_ids.end());
+  std::reverse(lane.offsets.begin(), lane.offsets.end());
+  offset = 0.0;
+  for (const auto lanelet_id : following_lanelet_ids) {
+    lane.lanelet_ids.push_back(lanelet_id);
+    lane.offsets.push_back(offset);
+    offset += hdmap_utils.getLaneletLength(lanelet_id);
+  }
+  return lane;
+}
+
+auto findNeighbours(
+  const OtherEntityStatusView & other_entity_status, const Lane & lane, double s,
+  const traffic_simulator_msgs::msg::BoundingBox & bounding_box) -> Neighbours
+{
+  Neighbours neighbours;
+  /// @note Signed distances between the origins of the vehicle and its leader and follower.
+  std::optional<double> leader_distance, follower_distance;
+  for (const auto & each : other_entity_status.getEntitiesOnLanelets(lane.lanelet_ids)) {
+    const auto lanelet_pose = each->second.getLaneletPose();
+    const auto index = std::distance(
+      lane.lanelet_ids.begin(),
+      std::find(lane.lanelet_ids.begin(), lane.lanelet_ids.end(), lanelet_pose.lanelet_id));
+    const auto distance = lane.offsets[index] + lanelet_pose.s - s;
+    const auto other_bounding_box = each->second.getBoundingBox();
+    /// @note Entities crossing the lane, like pedestrians on a crosswalk, do not move along it.
+    const auto speed = each->second.getTwist().linear.x * std::cos(lanelet_pose.rpy.z);
+    if (distance >= 0.0) {
+      if (not leader_distance or distance < leader_distance.value()) {
+        leader_distance = distance;
+        neighbours.leader = Neighbour{
+          distance - getFrontLength(bounding_box) - getRearLength(other_bounding_box), speed};
+      }
+    } else {
+      if (not follower_distance or distance > follower_distance.value()) {
+        follower_distance = distance;
+        neighbours.follower = Neighbour{
+          -distance - getRearLength(bounding_box) - getFrontLength(other_bounding_box), speed};
+      }
+    }
+  }
+  return neighbours;
+}
+
+auto calculateAcceleration(
+  double speed, double desired_speed, const std::optional<Neighbour> & leader,
+  const Parameter & parameter) -> double
+{
+  /**
+   * @note With a desired speed of 0, the free road term is chosen so that a moving vehicle brakes
+   * with the comfortable deceleration and a stopped vehicle stays on a free road.
+   */
+  auto free_road_term = 1.0;
+  if (desired_speed > 0.0) {
+    free_road_term =
+      std::pow(std::max(speed, 0.0) / desired_speed, parameter.acceleration_exponent);
+  } else if (speed > 0.0) {
+    free_road_term = 1.0 + parameter.comfortable_deceleration / parameter.acceleration;
+  }
+  if (not leader) {
+    return parameter.acceleration * (1.0 - free_road_term);
+  }
+  const auto desired_gap =
+    parameter.minimum_gap +
+    std::max(
+      0.0, speed * parameter.time_headway +
+             speed * (speed - leader->speed) /
+               (2.0 * std::sqrt(parameter.acceleration * parameter.comfortable_deceleration)));
+  /// @note Overlapping bounding boxes are treated as a very small gap.
+  const auto gap = std::max(leader->gap, 1e-2);
+  return parameter.acceleration * (1.0 - free_road_term - std::pow(desired_gap / gap, 2));
+}
+
+auto calculateLaneChangeIncentive(
+  double speed, double desired_speed, double length, const Neighbours & current_lane,
+  const Neighbours & target_lane, const Parameter & parameter) -> std::optional<double>
+{
+  if (
+    (target_lane.leader and target_lane.leader->gap < 0.0) or
+    (target_lane.follower and target_lane.follower->gap < 0.0)) {
+    return std::nullopt;
+  }
+
+  /// @note Leader of a follower after the vehicle leaves the lane of the follower.
+  const auto leader_without_vehicle =
+    [&](const Neighbour & follower, const std::optional<Neighbour> & leader)
+    -> std::optional<Neighbour> {
+    if (leader) {
+      return Neighbour{follower.gap + length + leader->gap, leader->speed};
+    } else {
+      return std::nullopt;
+    }
+  };
+
+  const auto advantage =
+    calculateAcceleration(speed, desired_speed, target_lane.leader, parameter) -
+    calculateAcceleration(speed, desired_speed, current_lane.leader, parameter);
+
+  double disadvantage = 0.0;
+  if (const auto & follower = target_lane.follower) {
+    const auto acceleration = calculateAcceleration(
+      follower->speed, desired_speed, Neighbour{follower->gap, speed}, parameter);
+    if (acceleration < -parameter.safe_deceleration) {
+      return std::nullopt;
+    }
+    disadvantage += calculateAcceleration(
+                      follower->speed, desired_speed,
+                      leader_without_vehicle(*follower, target_lane.leader), parameter) -
+                    acceleration;
+  }
+  if (const auto & follower = current_lane.follower) {
+    disadvantage +=
+      calculateAcceleration(
+        follower->speed, desired_speed, Neighbour{follower->gap, speed}, parameter) -
+      calculateAcceleration(
+        follower->speed, desired_speed, leader_without_vehicle(*follower, current_lane.leader),
+        parameter);
+  }
+  return advantage - parameter.politeness * disadvantage;
+}
+}  // namespace intelligent_driver_model
+}  // namespace traffic_simulator
@@ -13,8 +13,10 @@
 // limitations under the License.
 
 #include <algorithm>
+#include <cmath>
 #include <geometry/linear_algebra.hpp>
 #include <iostream>
+#include <limits>
 #include <rclcpp/rclcpp.hpp>
 #include <scenario_simulator_exception/exception.hpp>
 #include <traffic_simulator/behavior/longitudinal_speed_planning.hpp>
@@ -24,7 +26,7 @@ namespace traffic_simulator
 namespace longitudinal_speed_planning
 {
 LongitudinalSpeedPlanner::LongitudinalSpeedPlanner(double step_time, const std::string & entity)
-: step_time(step_time), entity(entity)
+: step_time_(step_time), entity_(entity)
 {
 }
 
@@ -85,7 +87,7 @@ auto LongitudinalSpeedPlanner::getDynamicStates(
 {
   if (std::fabs(target_speed) > constraints.max_speed) {
     THROW_SEMANTIC_ERROR(
-      "Target speed is ", std::to_string(target_speed), " , it overs ", entity,
+      "Target speed is ", std::to_string(target_speed), " , it overs ", entity_,
       "'s max_speed:", std::to_string(constraints.max_speed));
   }
   double linear_jerk = planLinearJerk(target_speed, constraints, current_twist, current_accel);
@@ -99,7 +101,7 @@ auto LongitudinalSpeedPlanner::getDynamicStates(
 auto LongitudinalSpeedPlanner::getRunningDistance(
   double target_speed, const traffic_simulator_msgs::msg::DynamicConstraints & constraints,
   const geometry_msgs::msg::Twist & current_twist, const geometry_msgs::msg::Accel & current_accel,
-  double current_linear_jerk) const -> double
+  double /* current_linear_jerk */) const -> double
 {
   /**
    * @brief A value of 0.01 is the allowable range for determination of target
@@ -110,17 +112,82 @@ auto LongitudinalSpeedPlanner::getRunningDistance(
   if (isTargetSpeedReached(target_speed, current_twist, twist_tolerance)) {
     return 0;
   }
-  double ret = 0;
-  std::tuple<geometry_msgs::msg::Twist, geometry_msgs::msg::Accel, double> next_state =
-    std::make_tuple(current_twist, current_accel, current_linear_jerk);
-  do {
-    next_state =
-      getDynamicStates(target_speed, constraints, std::get<0>(next_state), std::get<1>(next_state));
-    ret = ret + std::get<0>(next_state).linear.x * step_time +
-          std::get<1>(next_state).linear.x * step_time * step_time / 2.0 +
-          std::get<2>(next_state) * step_time * step_time * step_time / 6.0;
-  } while (!isTargetSpeedReached(target_speed, std::get<0>(next_state), twist_tolerance));
-  return ret;
+  if (std::fabs(target_speed) > constraints.max_speed) {
+    THROW_SEMANTIC_ERROR(
+      "Target speed is ", std::to_string(target_speed), " , it overs ", entity_,
+      "'s max_speed:", std::to_string(constraints.max_speed));
+  }
+  /**
+   * @note Closed form of stepping getDynamicStates until the target speed is reached.
+   * In the direction of the speed change, step k applies the acceleration
+   * min(b_1 + (k - 1) * jerk_step, acceleration_limit, gap_{k-1} / step_time_), where gap_k is the
+   * remaining difference to the target speed. While the last bound is not active, the speed change
+   * and the travelled distance are sums of arithmetic series.
+   */
+  const double sign = isAccelerating(target_speed, current_twist) ? 1.0 : -1.0;
+  const double acceleration_limit =
+    sign > 0 ? constraints.max_acceleration : constraints.max_deceleration;
+  const double jerk_step =
+    (sign > 0 ? constraints.max_acceleration_rate : constraints.max_deceleration_rate) * step_time_;
+  const double initial_gap = sign * (target_speed - current_twist.linear.x);
+  const double initial_acceleration =
+    std::clamp(sign * current_accel.linear.x + jerk_step, 0.0, acceleration_limit);
+  /// @note With a zero acceleration_limit, the speed change of every step is 0 whatever the jerk.
+  if (acceleration_limit <= 0 or (initial_acceleration <= 0 and jerk_step <= 0)) {
+    THROW_SIMULATION_ERROR(
+      entity_, " never reaches the target speed ", std::to_string(target_speed),
+      " with the given dynamic constraints.");
+  }
+  /// @note Number of steps before the acceleration reaches acceleration_limit.
+  const double ramp_steps =
+    initial_acceleration >= acceleration_limit
+      ? 0.0
+      : (jerk_step > 0 ? std::ceil((acceleration_limit - initial_acceleration) / jerk_step)
+                       : std::numeric_limits<double>::infinity());
+  /// @note Sum of the accelerations of the first n steps, ignoring the gap bound.
+  const auto speed_change = [&](double n) {
+    const double ramp = std::min(n, ramp_steps);
+    return ramp * initial_acceleration + jerk_step * ramp * (ramp - 1) / 2 +
+           (n - ramp) * acceleration_limit;
+  };
+  /// @note Sum of speed_change(k) for k = 1, ..., n.
+  const auto sum_of_speed_change = [&](double n) {
+    const double ramp = std::min(n, ramp_steps);
+    return initial_acceleration * ramp * (ramp + 1) / 2 +
+           jerk_step * (ramp - 1) * ramp * (ramp + 1) / 6 + (n - ramp) * speed_change(ramp) +
+           acceleration_limit * (n - ramp) * (n - ramp + 1) / 2;
+  };
+  /// @note The first step after which the remaining gap is within twist_tolerance.
+  const double required_speed_change = (initial_gap - twist_tolerance) / step_time_;
+  double steps = [&]() {
+    if (std::isinf(ramp_steps) or speed_change(ramp_steps) >= required_speed_change) {
+      if (jerk_step <= 0) {
+        return std::ceil(required_speed_change / initial_acceleration);
+      }
+      const double b = initial_acceleration - jerk_step / 2;
+      return std::ceil(
+        (-b + std::sqrt(b * b + 2 * jerk_step * required_speed_change)) / jerk_step);
+    } else {
+      return ramp_steps +
+             std::ceil((required_speed_change - speed_change(ramp_steps)) / acceleration_limit);
+    }
+  }();
+  /// @note Correct rounding errors of the closed form solution.
+  steps = std::max(steps, 1.0);
+  while (steps > 1 and speed_change(steps - 1) >= required_speed_change) {
+    steps = steps - 1;
+  }
+  while (speed_change(steps) < required_speed_change) {
+    steps = steps + 1;
+  }
+  const double last_gap = std::max(initial_gap - step_time_ * speed_change(steps), 0.0);
+  const double sum_of_gaps =
+    (steps - 1) * initial_gap - step_time_ * sum_of_speed_change(steps - 1) + last_gap;
+  const double last_acceleration =
+    sign * (initial_gap - step_time_ * speed_change(steps - 1) - last_gap) / step_time_;
+  return step_time_ * (steps * target_speed - sign * sum_of_gaps) +
+         step_time_ * sign * (initial_gap - last_gap) / 2.0 +
+         (last_acceleration - current_accel.linear.x) * step_time_ * step_time_ / 6.0;
 }
 
 auto LongitudinalSpeedPlanner::isTargetSpeedReached(
@@ -263,16 +330,16 @@ auto LongitudinalSpeedPlanner::planLinearJerk(
   double accel_x_new = 0;
   if (isAccelerating(target_speed, current_twist)) {
     accel_x_new = std::clamp(
-      current_accel.linear.x + step_time * constraints.max_acceleration_rate, 0.0,
-      std::min(constraints.max_acceleration, (target_speed - current_twist.linear.x) / step_time));
+      current_accel.linear.x + step_time_ * constraints.max_acceleration_rate, 0.0,
+      std::min(constraints.max_acceleration, (target_speed - current_twist.linear.x) / step_time_));
   } else {
     accel_x_new = std::clamp(
-      current_accel.linear.x - step_time * constraints.max_deceleration_rate,
+      current_accel.linear.x - step_time_ * constraints.max_deceleration_rate,
       std::max(
-        constraints.max_deceleration * -1, (target_speed - current_twist.linear.x) / step_time),
+        constraints.max_deceleration * -1, (target_speed - current_twist.linear.x) / step_time_),
       0.0);
   }
-  return (accel_x_new - current_accel.linear.x) / step_time;
+  return (accel_x_new - current_accel.linear.x) / step_time_;
 }
 
 auto LongitudinalSpeedPlanner::forward(
@@ -281,7 +348,7 @@ auto LongitudinalSpeedPlanner::forward(
   -> geometry_msgs::msg::Accel
 {
   geometry_msgs::msg::Accel ret = accel;
-  ret.linear.x = accel.linear.x + step_time * linear_jerk;
+  ret.linear.x = accel.linear.x + step_time_ * linear_jerk;
   ret.linear.x =
     std::clamp(ret.linear.x, constraints.max_deceleration * -1, constraints.max_acceleration);
   return ret;
@@ -293,9 +360,9 @@ auto LongitudinalSpeedPlanner::forward(
   -> geometry_msgs::msg::Twist
 {
   geometry_msgs::msg::Twist ret = twist;
-  ret.linear = ret.linear + accel.linear * step_time;
+  ret.linear = ret.linear + accel.linear * step_time_;
   ret.linear.x = std::clamp(ret.linear.x, -1 * constraints.max_speed, constraints.max_speed);
-  ret.angular = ret.angular + accel.angular * step_time;
+  ret.angular = ret.angular + accel.angular * step_time_;
   return ret;
 }
 
@@ -304,15 +371,15 @@ auto LongitudinalSpeedPlanner::timeDerivative(
   -> geometry_msgs::msg::Accel
 {
   geometry_msgs::msg::Accel ret;
-  ret.linear = (after.linear - before.linear) / step_time;
-  ret.angular = (after.angular - before.angular) / step_time;
+  ret.linear = (after.linear - before.linear) / step_time_;
+  ret.angular = (after.angular - before.angular) / step_time_;
   return ret;
 }
 
 auto LongitudinalSpeedPlanner::timeDerivative(
   const geometry_msgs::msg::Accel & before, const geometry_msgs::msg::Accel & after) const -> double
 {
-  return (after.linear.x - before.linear.x) / step_time;
+  return (after.linear.x - before.linear.x) / step_time_;
 }
 }  // namespace longitudinal_speed_planning
 }  // namespace traffic_simulator
@@ -0,0 +1,345 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <scenario_simulator_exception/exception.hpp>
+#include <sstream>
+#include <string_view>
+#include <traffic_simulator/behavior/replay_trajectory.hpp>
+#include <tuple>
+
+namespace traffic_simulator
+{
+namespace replay_trajectory
+{
+namespace
+{
+constexpr std::size_t number_of_columns = 14;
+
+constexpr char binary_format_magic[8] = {'R', 'E', 'P', 'L', 'A', 'Y', '0', '1'};
+
+/// @note Number of segments passed by a query before falling back to a binary search.
+constexpr std::size_t linear_search_limit = 8;
+
+auto toColumns(const State & state) -> std::array<double, number_of_columns>
+{
+  const auto & [position, orientation] = std::tie(state.pose.position, state.pose.orientation);
+  const auto & [linear, angular] = std::tie(state.twist.linear, state.twist.angular);
+  return {state.time,    position.x,    position.y,    position.z, orientation.x,
+          orientation.y, orientation.z, orientation.w, linear.x,   linear.y,
+          linear.z,      angular.x,     angular.y,     angular.z};
+}
+
+auto fromColumns(const std::array<double, number_of_columns> & columns) -> State
+{
+  State state;
+  state.time = columns[0];
+  state.pose.position.x = columns[1];
+  state.pose.position.y = columns[2];
+  state.pose.position.z = columns[3];
+  state.pose.orientation.x = columns[4];
+  state.pose.orientation.y = columns[5];
+  state.pose.orientation.z = columns[6];
+  state.pose.orientation.w = columns[7];
+  state.twist.linear.x = columns[8];
+  state.twist.linear.y = columns[9];
+  state.twist.linear.z = columns[10];
+  state.twist.angular.x = columns[11];
+  state.twist.angular.y = columns[12];
+  state.twist.angular.z = columns[13];
+  return state;
+}
+
+auto loadCsv(const std::string & path) -> std::vector<State>
+{
+  std::ifstream file(path);
+  if (not file) {
+    THROW_SEMANTIC_ERROR("Failed to open the trajectory file ", std::quoted(path), ".");
+  }
+  std::vector<State> states;
+  std::size_t line_number = 0;
+  for (std::string line; std::getline(file, line);) {
+    ++line_number;
+    if (line.empty() or line.front() == '#' or line.find_first_not_of(" \t\r") == line.npos) {
+      continue;
+    }
+    std::array<double, number_of_columns> columns;
+    std::size_t number_of_parsed_columns = 0;
+    bool numeric = true;
+    std::istringstream line_stream(line);
+    for (std::string cell; std::getline(line_stream, cell, ',');) {
+      if (number_of_parsed_columns == number_of_columns) {
+        ++number_of_parsed_columns;
+        break;
+      }
+      try {
+        std::size_t parsed_size = 0;
+        columns[number_of_parsed_columns++] = std::stod(cell, &parsed_size);
+        numeric = cell.find_first_not_of(" \t\r", parsed_size) == cell.npos;
+      } catch (const std::logic_error &) {
+        numeric = false;
+      }
+      if (not numeric) {
+        break;
+      }
+    }
+    if (not numeric and line_number == 1) {
+      continue;  // header line
+    } else if (not numeric or number_of_parsed_columns != number_of_columns) {
+      THROW_SEMANTIC_ERROR(
+        "Line ", line_number, " of the trajectory file ", std::quoted(path), " does not have ",
+        number_of_columns, " numeric columns.");
+    }
+    states.push_back(fromColumns(columns));
+  }
+  return states;
+}
+
+auto loadBinary(const std::string & path) -> std::vector<State>
+{
+  std::ifstream file(path, std::ios::binary);
+  if (not file) {
+    THROW_SEMANTIC_ERROR("Failed to open the trajectory file ", std::quoted(path), ".");
+  }
+  char magic[sizeof(binary_format_magic)];
+  std::uint64_t size = 0;
+  if (
+    not file.read(magic, sizeof(magic)) or
+    std::memcmp(magic, binary_format_magic, sizeof(magic)) != 0 or
+    not file.read(reinterpret_cast<char *>(&size), sizeof(size))) {
+    THROW_SEMANTIC_ERROR(
+      "The trajectory file ", std::quoted(path),
+      " is neither a CSV file (*.csv) nor a binary trajectory file.");
+  }
+  /// @note The size is checked before reserving memory for it, since the file may be corrupted.
+  const auto position = file.tellg();
+  file.seekg(0, std::ios::end);
+  const auto remaining_size = static_cast<std::uint64_t>(file.tellg() - position);
+  file.seekg(position);
+  if (remaining_size / sizeof(std::array<double, number_of_columns>) < size) {
+    THROW_SEMANTIC_ERROR(
+      "The trajectory file ", std::quoted(path), " is truncated, it should have ", size,
+      " states.");
+  }
+  std::vector<State> states;
+  states.reserve(size);
+  for (std::uint64_t i = 0; i < size; ++i) {
+    std::array<double, number_of_columns> columns;
+    if (not file.read(reinterpret_cast<char *>(columns.data()), sizeof(columns))) {
+      THROW_SEMANTIC_ERROR("The trajectory file ", std::quoted(path), " is truncated.");
+    }
+    states.push_back(fromColumns(columns));
+  }
+  return states;
+}
+
+/// @note Rotates a vector in the frame of orientation into the map frame.
+auto rotate(const geometry_msgs::msg::Quaternion & q, const geometry_msgs::msg::Vector3 & v)
+  -> geometry_msgs::msg::Vector3
+{
+  /// @note v + 2w(u x v) + 2u x (u x v), where u is the vector part of q.
+  const auto tx = 2.0 * (q.y * v.z - q.z * v.y);
+  const auto ty = 2.0 * (q.z * v.x - q.x * v.z);
+  const auto tz = 2.0 * (q.x * v.y - q.y * v.x);
+  geometry_msgs::msg::Vector3 rotated;
+  rotated.x = v.x + q.w * tx + (q.y * tz - q.z * ty);
+  rotated.y = v.y + q.w * ty + (q.z * tx - q.x * tz);
+  rotated.z = v.z + q.w * tz + (q.x * ty - q.y * tx);
+  return rotated;
+}
+
+/// @note Normalized linear interpolation along the shorter arc, close to slerp for small angles.
+auto nlerp(
+  const geometry_msgs::msg::Quaternion & a, const geometry_msgs::msg::Quaternion & b, double ratio)
+  -> geometry_msgs::msg::Quaternion
+{
+  const auto sign = a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w < 0.0 ? -1.0 : 1.0;
+  geometry_msgs::msg::Quaternion q;
+  q.x = a.x + (sign * b.x - a.x) * ratio;
+  q.y = a.y + (sign * b.y - a.y) * ratio;
+  q.z = a.z + (sign * b.z - a.z) * ratio;
+  q.w = a.w + (sign * b.w - a.w) * ratio;
+  const auto norm = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+  q.x /= norm;
+  q.y /= norm;
+  q.z /= norm;
+  q.w /= norm;
+  return q;
+}
+
+template <typename T>
+auto lerp(const T & a, const T & b, double ratio) -> T
+{
+  T v;
+  v.x = a.x + (b.x - a.x) * ratio;
+  v.y = a.y + (b.y - a.y) * ratio;
+  v.z = a.z + (b.z - a.z) * ratio;
+  return v;
+}
+}  // namespace
+
+Trajectory::Trajectory(std::vector<State> states, Interpolation interpolation)
+: states_(std::move(states)), interpolation_(interpolation)
+{
+  if (states_.empty()) {
+    THROW_SEMANTIC_ERROR("A replayed trajectory should have at least one state.");
+  }
+  for (std::size_t i = 0; i < states_.size(); ++i) {
+    if (const auto columns = toColumns(states_[i]); not std::all_of(
+          columns.begin(), columns.end(), [](auto value) { return std::isfinite(value); })) {
+      THROW_SEMANTIC_ERROR("State ", i, " of a replayed trajectory contains NaN or infinity.");
+    } else if (0 < i and states_[i].time <= states_[i - 1].time) {
+      THROW_SEMANTIC_ERROR(
+        "States of a replayed trajectory should be sorted by time without duplicates, but state ",
+        i, " is at ", states_[i].time, " after ", states_[i - 1].time, ".");
+    }
+  }
+}
+
+auto Trajectory::load(const std::string & path, Interpolation interpolation) -> Trajectory
+{
+  constexpr std::string_view csv_extension = ".csv";
+  if (
+    csv_extension.size() <= path.size() and
+    path.compare(path.size() - csv_extension.size(), csv_extension.size(), csv_extension) == 0) {
+    return Trajectory(loadCsv(path), interpolation);
+  } else {
+    return Trajectory(loadBinary(path), interpolation);
+  }
+}
+
+auto Trajectory::save(const std::string & path) const -> void
+{
+  std::ofstream file(path, std::ios::binary);
+  const std::uint64_t size = states_.size();
+  file.write(binary_format_magic, sizeof(binary_format_magic));
+  file.write(reinterpret_cast<const char *>(&size), sizeof(size));
+  for (const auto & state : states_) {
+    const auto columns = toColumns(state);
+    file.write(reinterpret_cast<const char *>(columns.data()), sizeof(columns));
+  }
+  if (not file) {
+    THROW_SIMULATION_ERROR("Failed to write the trajectory file ", std::quoted(path), ".");
+  }
+}
+
+auto Trajectory::interpolate(double elapsed_time, std::size_t & hint) const -> State
+{
+  const auto time = states_.front().time + std::clamp(elapsed_time, 0.0, getDuration());
+  if (states_.size() == 1) {
+    return states_.front();
+  }
+
+  /// @note Finds the segment from states_[hint] to states_[hint + 1] which contains time.
+  if (hint = std::min(hint, states_.size() - 2); time < states_[hint].time) {
+    hint = states_.size();
+  } else {
+    for (std::size_t i = 0; states_[hint + 1].time < time; ++hint) {
+      if (linear_search_limit < ++i) {
+        hint = states_.size();
+        break;
+      }
+    }
+  }
+  if (hint == states_.size()) {
+    const auto next = std::upper_bound(
+      states_.begin() + 1, states_.end() - 1, time,
+      [](auto time, const auto & state) { return time < state.time; });
+    hint = std::distance(states_.begin(), next) - 1;
+  }
+
+  const auto & [from, to] = std::tie(states_[hint], states_[hint + 1]);
+  const auto duration = to.time - from.time;
+  const auto ratio = (time - from.time) / duration;
+  State state;
+  state.time = time;
+  state.pose.orientation = nlerp(from.pose.orientation, to.pose.orientation, ratio);
+  state.twist.linear = lerp(from.twist.linear, to.twist.linear, ratio);
+  state.twist.angular = lerp(from.twist.angular, to.twist.angular, ratio);
+  switch (interpolation_) {
+    case Interpolation::LINEAR:
+      state.pose.position = lerp(from.pose.position, to.pose.position, ratio);
+      break;
+    case Interpolation::CUBIC_HERMITE: {
+      const auto from_velocity = rotate(from.pose.orientation, from.twist.linear);
+      const auto to_velocity = rotate(to.pose.orientation, to.twist.linear);
+      const auto h00 = (1 + 2 * ratio) * (1 - ratio) * (1 - ratio);
+      const auto h10 = ratio * (1 - ratio) * (1 - ratio);
+      const auto h01 = ratio * ratio * (3 - 2 * ratio);
+      const auto h11 = ratio * ratio * (ratio - 1);
+      const auto hermite = [&](auto p0, auto v0, auto p1, auto v1) {
+        return h00 * p0 + h10 * duration * v0 + h01 * p1 + h11 * duration * v1;
+      };
+      state.pose.position.x =
+        hermite(from.pose.position.x, from_velocity.x, to.pose.position.x, to_velocity.x);
+      state.pose.position.y =
+        hermite(from.pose.position.y, from_velocity.y, to.pose.position.y, to_velocity.y);
+      state.pose.position.z =
+        hermite(from.pose.position.z, from_velocity.z, to.pose.position.z, to_velocity.z);
+      break;
+    }
+  }
+  return state;
+}
+
+Cursor::Cursor(const std::shared_ptr<const Trajectory> & trajectory) : trajectory_(trajectory)
+{
+  if (not trajectory_) {
+    THROW_SEMANTIC_ERROR("A replayed trajectory should not be null.");
+  }
+}
+
+auto Cursor::makeUpdatedStatus(
+  const traffic_simulator_msgs::msg::EntityStatus & entity_status, double step_time)
+  -> std::optional<traffic_simulator_msgs::msg::EntityStatus>
+{
+  const auto time = entity_status.time + step_time;
+  if (not start_time_) {
+    start_time_ = time;
+  }
+  if (const auto elapsed_time = time - start_time_.value();
+      trajectory_->getDuration() < elapsed_time) {
+    return std::nullopt;
+  } else {
+    const auto state = trajectory_->interpolate(elapsed_time, hint_);
+    auto updated_status = entity_status;
+    updated_status.time = time;
+    updated_status.pose = state.pose;
+    updated_status.action_status.twist = state.twist;
+    const auto accel = [&](const auto & updated, const auto & current) {
+      geometry_msgs::msg::Vector3 accel;
+      accel.x = (updated.x - current.x) / step_time;
+      accel.y = (updated.y - current.y) / step_time;
+      accel.z = (updated.z - current.z) / step_time;
+      return accel;
+    };
+    updated_status.action_status.accel.linear =
+      accel(state.twist.linear, entity_status.action_status.twist.linear);
+    updated_status.action_status.accel.angular =
+      accel(state.twist.angular, entity_status.action_status.twist.angular);
+    updated_status.action_status.linear_jerk =
+      (updated_status.action_status.accel.linear.x - entity_status.action_status.accel.linear.x) /
+      step_time;
+    updated_status.lanelet_pose_valid = false;
+    return updated_status;
+  }
+}
+}  // namespace replay_trajectory
+}  // namespace traffic_simulator
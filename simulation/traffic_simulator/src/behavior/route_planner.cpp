@@ -41,21 +41,46 @@ auto RoutePlanner::getRouteLanelets(
   // If the route from the entity_lanelet_pose to waypoint_queue_.front() was failed to calculate in updateRoute function,
   // use following lanelet as route.
   if (!route_) {
-    return hdmap_utils_ptr_->getFollowingLanelets(lanelet_pose.lanelet_id, horizon, true);
+    return getFollowingLanelets(lanelet_pose.lanelet_id, horizon, false);
   }
   if (route_ && hdmap_utils_ptr_->isInRoute(lanelet_pose.lanelet_id, route_.value())) {
-    return hdmap_utils_ptr_->getFollowingLanelets(
-      lanelet_pose.lanelet_id, route_.value(), horizon, true);
+    return getFollowingLanelets(lanelet_pose.lanelet_id, horizon, true);
   }
   // If the entity_lanelet_pose is in the lanelet id of the waypoint queue, cancel the target waypoint.
   cancelWaypoint(entity_lanelet_pose);
-  return hdmap_utils_ptr_->getFollowingLanelets(lanelet_pose.lanelet_id, horizon, true);
+  return getFollowingLanelets(lanelet_pose.lanelet_id, horizon, false);
+}
+
+auto RoutePlanner::getFollowingLanelets(std::int64_t lanelet_id, double horizon, bool along_route)
+  -> std::vector<std::int64_t>
+{
+  const auto route_version =
+    along_route ? std::optional<std::uint64_t>(route_version_) : std::nullopt;
+  if (
+    route_horizon_ and route_horizon_->lanelet_id == lanelet_id and
+    route_horizon_->horizon == horizon and route_horizon_->route_version == route_version) {
+    cache_statistics_.hits++;
+  } else {
+    cache_statistics_.misses++;
+    route_horizon_ = RouteHorizon{
+      lanelet_id, horizon, route_version,
+      along_route
+        ? hdmap_utils_ptr_->getFollowingLanelets(lanelet_id, route_.value(), horizon, true)
+        : hdmap_utils_ptr_->getFollowingLanelets(lanelet_id, horizon, true)};
+  }
+  return route_horizon_->lanelet_ids;
+}
+
+auto RoutePlanner::setRoute(const std::optional<std::vector<std::int64_t>> & route) -> void
+{
+  route_ = route;
+  route_version_++;
 }
 
 void RoutePlanner::cancelRoute()
 {
   waypoint_queue_.clear();
-  route_ = std::nullopt;
+  setRoute(std::nullopt);
 }
 
 void RoutePlanner::cancelWaypoint(const CanonicalizedLaneletPose & entity_lanelet_pose)
@@ -103,15 +128,15 @@ auto RoutePlanner::updateRoute(const CanonicalizedLaneletPose & entity_lanelet_p
   }
   const auto lanelet_pose = static_cast<LaneletPose>(entity_lanelet_pose);
   if (!route_) {
-    route_ = hdmap_utils_ptr_->getRoute(
-      lanelet_pose.lanelet_id, static_cast<LaneletPose>(waypoint_queue_.front()).lanelet_id);
+    setRoute(hdmap_utils_ptr_->getRoute(
+      lanelet_pose.lanelet_id, static_cast<LaneletPose>(waypoint_queue_.front()).lanelet_id));
     return;
   }
   if (hdmap_utils_ptr_->isInRoute(lanelet_pose.lanelet_id, route_.value())) {
     return;
   } else {
-    route_ = hdmap_utils_ptr_->getRoute(
-      lanelet_pose.lanelet_id, static_cast<LaneletPose>(waypoint_queue_.front()).lanelet_id);
+    setRoute(hdmap_utils_ptr_->getRoute(
+      lanelet_pose.lanelet_id, static_cast<LaneletPose>(waypoint_queue_.front()).lanelet_id));
     return;
   }
 }
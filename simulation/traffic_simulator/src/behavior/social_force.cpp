@@ -0,0 +1,157 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <quaternion_operation/quaternion_operation.h>
+
+#include <algorithm>
+#include <cmath>
+#include <traffic_simulator/behavior/social_force.hpp>
+
+namespace traffic_simulator
+{
+namespace social_force
+{
+namespace
+{
+auto getYaw(const geometry_msgs::msg::Pose & pose) -> double
+{
+  return quaternion_operation::convertQuaternionToEulerAngle(pose.orientation).z;
+}
+
+/// @note Center of the bounding box in the map frame.
+auto getCenter(const CanonicalizedEntityStatus & status) -> geometry_msgs::msg::Point
+{
+  const auto pose = status.getMapPose();
+  const auto bounding_box = status.getBoundingBox();
+  const auto yaw = getYaw(pose);
+  geometry_msgs::msg::Point center;
+  center.x = pose.position.x + std::cos(yaw) * bounding_box.center.x -
+             std::sin(yaw) * bounding_box.center.y;
+  center.y = pose.position.y + std::sin(yaw) * bounding_box.center.x +
+             std::cos(yaw) * bounding_box.center.y;
+  center.z = pose.position.z;
+  return center;
+}
+}  // namespace
+
+auto calculateAcceleration(
+  const CanonicalizedEntityStatus & pedestrian, double target_speed,
+  const OtherEntityStatusView & other_entity_status, const Parameter & parameter)
+  -> geometry_msgs::msg::Vector3
+{
+  const auto pose = pedestrian.getMapPose();
+  const auto bounding_box = pedestrian.getBoundingBox();
+  const auto yaw = getYaw(pose);
+  const auto center = getCenter(pedestrian);
+  /// @note The pedestrian is approximated by a circle, other entities by their bounding box.
+  const auto radius = std::max(bounding_box.dimensions.x, bounding_box.dimensions.y) / 2.0;
+
+  double force_x = 0.0;
+  double force_y = 0.0;
+  for (const auto & each : other_entity_status.getEntitiesWithin(
+         center, radius + parameter.neighbour_distance +
+                   other_entity_status.getMaximumBoundingRadius())) {
+    const auto other_pose = each->second.getMapPose();
+    const auto other_bounding_box = each->second.getBoundingBox();
+    const auto other_yaw = getYaw(other_pose);
+    /// @note Center of the pedestrian in the bounding box frame of the other entity.
+    const auto dx = center.x - other_pose.position.x;
+    const auto dy = center.y - other_pose.position.y;
+    const auto local_x =
+      std::cos(other_yaw) * dx + std::sin(other_yaw) * dy - other_bounding_box.center.x;
+    const auto local_y =
+      -std::sin(other_yaw) * dx + std::cos(other_yaw) * dy - other_bounding_box.center.y;
+    /// @note Direction from the closest point of the bounding box to the pedestrian.
+    auto normal_x = local_x - std::clamp(
+                                local_x, -other_bounding_box.dimensions.x / 2.0,
+                                other_bounding_box.dimensions.x / 2.0);
+    auto normal_y = local_y - std::clamp(
+                                local_y, -other_bounding_box.dimensions.y / 2.0,
+                                other_bounding_box.dimensions.y / 2.0);
+    const auto distance = std::hypot(normal_x, normal_y);
+    if (distance - radius > parameter.neighbour_distance) {
+      continue;
+    }
+    if (distance <= 0.0) {
+      /// @note The pedestrian is inside the bounding box, so it is pushed out from its center.
+      normal_x = local_x;
+      normal_y = local_y;
+    }
+    if (const auto length = std::hypot(normal_x, normal_y); length > 0.0) {
+      normal_x /= length;
+      normal_y /= length;
+    } else {
+      normal_x = -1.0;
+      normal_y = 0.0;
+    }
+    const auto map_normal_x = std::cos(other_yaw) * normal_x - std::sin(other_yaw) * normal_y;
+    const auto map_normal_y = std::sin(other_yaw) * normal_x + std::cos(other_yaw) * normal_y;
+    /// @note Cosine of the angle between the heading of the pedestrian and the other entity.
+    const auto cos_phi = -(std::cos(yaw) * map_normal_x + std::sin(yaw) * map_normal_y);
+    const auto magnitude =
+      parameter.interaction_strength * std::exp((radius - distance) / parameter.interaction_range) *
+      (parameter.anisotropy + (1.0 - parameter.anisotropy) * (1.0 + cos_phi) / 2.0);
+    const auto bias = parameter.right_hand_bias * std::max(cos_phi, 0.0);
+    force_x += magnitude * (map_normal_x + bias * std::sin(yaw));
+    force_y += magnitude * (map_normal_y - bias * std::cos(yaw));
+  }
+
+  const auto twist = pedestrian.getTwist();
+  geometry_msgs::msg::Vector3 acceleration;
+  acceleration.x = (target_speed - twist.linear.x) / parameter.relaxation_time +
+                   std::cos(yaw) * force_x + std::sin(yaw) * force_y;
+  acceleration.y =
+    -twist.linear.y / parameter.relaxation_time - std::sin(yaw) * force_x + std::cos(yaw) * force_y;
+  return acceleration;
+}
+
+auto makeUpdatedStatus(
+  const CanonicalizedEntityStatus & pedestrian, double target_speed,
+  const OtherEntityStatusView & other_entity_status,
+  const traffic_simulator_msgs::msg::BehaviorParameter & behavior_parameter, double step_time,
+  const Parameter & parameter) -> traffic_simulator_msgs::msg::EntityStatus
+{
+  const auto acceleration =
+    calculateAcceleration(pedestrian, target_speed, other_entity_status, parameter);
+  const auto twist = pedestrian.getTwist();
+  /// @note The pedestrian never walks backward, and never walks faster than max_speed.
+  auto velocity_x = std::max(twist.linear.x + acceleration.x * step_time, 0.0);
+  auto velocity_y = twist.linear.y + acceleration.y * step_time;
+  if (const auto speed = std::hypot(velocity_x, velocity_y);
+      speed > behavior_parameter.dynamic_constraints.max_speed) {
+    velocity_x *= behavior_parameter.dynamic_constraints.max_speed / speed;
+    velocity_y *= behavior_parameter.dynamic_constraints.max_speed / speed;
+  }
+
+  auto updated_status = static_cast<EntityStatus>(pedestrian);
+  const auto yaw = getYaw(updated_status.pose);
+  updated_status.pose.position.x +=
+    (std::cos(yaw) * velocity_x - std::sin(yaw) * velocity_y) * step_time;
+  updated_status.pose.position.y +=
+    (std::sin(yaw) * velocity_x + std::cos(yaw) * velocity_y) * step_time;
+  updated_status.action_status.twist = geometry_msgs::msg::Twist();
+  updated_status.action_status.twist.linear.x = velocity_x;
+  updated_status.action_status.twist.linear.y = velocity_y;
+  updated_status.action_status.accel = geometry_msgs::msg::Accel();
+  updated_status.action_status.accel.linear.x = (velocity_x - twist.linear.x) / step_time;
+  updated_status.action_status.accel.linear.y = (velocity_y - twist.linear.y) / step_time;
+  updated_status.action_status.linear_jerk =
+    (updated_status.action_status.accel.linear.x - pedestrian.getAccel().linear.x) / step_time;
+  updated_status.time = pedestrian.getTime() + step_time;
+  updated_status.lanelet_pose_valid = false;
+  updated_status.lanelet_pose = LaneletPose();
+  return updated_status;
+}
+}  // namespace social_force
+}  // namespace traffic_simulator
@@ -0,0 +1,124 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <scenario_simulator_exception/exception.hpp>
+#include <sstream>
+#include <string>
+#include <traffic_simulator/behavior/tick_profiler.hpp>
+#include <utility>
+
+namespace traffic_simulator
+{
+namespace behavior
+{
+auto TickProfiler::Statistics::record(std::chrono::nanoseconds duration) noexcept -> void
+{
+  const auto nanoseconds = static_cast<std::uint64_t>(std::max<std::int64_t>(duration.count(), 0));
+  count_.fetch_add(1, std::memory_order_relaxed);
+  total_nanoseconds_.fetch_add(nanoseconds, std::memory_order_relaxed);
+  for (auto minimum = minimum_nanoseconds_.load(std::memory_order_relaxed);
+       nanoseconds < minimum and not minimum_nanoseconds_.compare_exchange_weak(
+                                   minimum, nanoseconds, std::memory_order_relaxed);) {
+  }
+  for (auto maximum = maximum_nanoseconds_.load(std::memory_order_relaxed);
+       maximum < nanoseconds and not maximum_nanoseconds_.compare_exchange_weak(
+                                   maximum, nanoseconds, std::memory_order_relaxed);) {
+  }
+  const std::size_t bucket = nanoseconds == 0 ? 0 : 63 - __builtin_clzll(nanoseconds);
+  histogram_[std::min(bucket, number_of_buckets - 1)].fetch_add(1, std::memory_order_relaxed);
+}
+
+auto TickProfiler::Statistics::reset() noexcept -> void
+{
+  count_.store(0, std::memory_order_relaxed);
+  total_nanoseconds_.store(0, std::memory_order_relaxed);
+  minimum_nanoseconds_.store(UINT64_MAX, std::memory_order_relaxed);
+  maximum_nanoseconds_.store(0, std::memory_order_relaxed);
+  for (auto & bucket : histogram_) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+}
+
+auto TickProfiler::get() -> TickProfiler &
+{
+  static TickProfiler profiler;
+  return profiler;
+}
+
+auto TickProfiler::getStatistics(const std::string & node_type) -> Statistics &
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto & statistics = statistics_[node_type];
+  if (not statistics) {
+    statistics = std::make_unique<Statistics>();
+  }
+  return *statistics;
+}
+
+auto TickProfiler::reset() -> void
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto & [node_type, statistics] : statistics_) {
+    statistics->reset();
+  }
+}
+
+auto TickProfiler::toJson() const -> std::string
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  std::stringstream json;
+  json << "{";
+  auto first_node_type = true;
+  for (const auto & [node_type, statistics] : statistics_) {
+    if (const auto count = statistics->count(); count != 0) {
+      const auto total = statistics->total_nanoseconds_.load(std::memory_order_relaxed);
+      json << (std::exchange(first_node_type, false) ? "" : ",") << std::quoted(node_type)
+           << ":{\"count\":" << count << ",\"total_ns\":" << total
+           << ",\"mean_ns\":" << total / count
+           << ",\"min_ns\":" << statistics->minimum_nanoseconds_.load(std::memory_order_relaxed)
+           << ",\"max_ns\":" << statistics->maximum_nanoseconds_.load(std::memory_order_relaxed)
+           << ",\"histogram\":[";
+      auto first_bucket = true;
+      for (std::size_t i = 0; i < Statistics::number_of_buckets; ++i) {
+        if (const auto bucket_count = statistics->histogram_[i].load(std::memory_order_relaxed)) {
+          json << (std::exchange(first_bucket, false) ? "" : ",")
+               << "{\"lower_ns\":" << (i == 0 ? 0 : std::uint64_t(1) << i) << ",\"upper_ns\":";
+          if (i + 1 < Statistics::number_of_buckets) {
+            json << (std::uint64_t(1) << (i + 1));
+          } else {
+            json << "null";
+          }
+          json << ",\"count\":" << bucket_count << "}";
+        }
+      }
+      json << "]}";
+    }
+  }
+  json << "}";
+  return json.str();
+}
+
+auto TickProfiler::dump(const std::string & path) const -> void
+{
+  if (std::ofstream file(path); not file) {
+    THROW_SIMULATION_ERROR("Failed to open ", std::quoted(path), " to dump the tick profile.");
+  } else {
+    file << toJson() << std::endl;
+  }
+}
+}  // namespace behavior
+}  // namespace traffic_simulator
@@ -0,0 +1,264 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <cmath>
+#include <scenario_simulator_exception/exception.hpp>
+#include <traffic_simulator/data_type/entity_status_snapshot.hpp>
+
+namespace traffic_simulator
+{
+auto EntityStatusSnapshot::emplace(
+  const std::string & name, const CanonicalizedEntityStatus & status) -> void
+{
+  if (const auto [index, inserted] = indices_.try_emplace(name, entries_.size()); not inserted) {
+    if (index->second != unused_index) {
+      THROW_SIMULATION_ERROR("entity : ", name, " is already in the entity status snapshot.");
+    }
+    index->second = entries_.size();
+  }
+  entries_.emplace_back(name, status);
+
+  const auto index = entries_.size() - 1;
+  const auto position = status.getMapPose().position;
+  const auto [cell_x, cell_y] = toGridCell(position.x, position.y);
+  grid_[toGridKey(cell_x, cell_y)].push_back(index);
+  if (status.laneMatchingSucceed()) {
+    lanelet_buckets_[status.getLaneletPose().lanelet_id].push_back(index);
+  }
+  const auto bounding_box = status.getBoundingBox();
+  maximum_bounding_radius_ = std::max(
+    maximum_bounding_radius_,
+    std::hypot(
+      std::abs(bounding_box.center.x) + bounding_box.dimensions.x * 0.5,
+      std::abs(bounding_box.center.y) + bounding_box.dimensions.y * 0.5));
+}
+
+auto EntityStatusSnapshot::clear() -> void
+{
+  /**
+   * @note Entities mostly stay in the same cells and lanelets over frames, so the nodes of the hash
+   * tables and the capacity of the buckets are kept for them instead of being allocated again.
+   */
+  const auto clearBuckets = [](auto & buckets) {
+    for (auto iter = buckets.begin(); iter != buckets.end();) {
+      if (iter->second.empty()) {
+        iter = buckets.erase(iter);
+      } else {
+        iter->second.clear();
+        ++iter;
+      }
+    }
+  };
+  for (auto iter = indices_.begin(); iter != indices_.end();) {
+    if (iter->second == unused_index) {
+      iter = indices_.erase(iter);
+    } else {
+      iter->second = unused_index;
+      ++iter;
+    }
+  }
+  clearBuckets(grid_);
+  clearBuckets(lanelet_buckets_);
+  entries_.clear();
+  maximum_bounding_radius_ = 0.0;
+}
+
+auto EntityStatusSnapshot::indicesWithin(const geometry_msgs::msg::Point & point, double radius)
+  const -> std::vector<std::size_t>
+{
+  std::vector<std::size_t> ret;
+  if (radius < 0) {
+    return ret;
+  }
+  const auto [min_x, min_y] = toGridCell(point.x - radius, point.y - radius);
+  const auto [max_x, max_y] = toGridCell(point.x + radius, point.y + radius);
+  for (auto cell_x = min_x; cell_x <= max_x; ++cell_x) {
+    for (auto cell_y = min_y; cell_y <= max_y; ++cell_y) {
+      if (const auto cell = grid_.find(toGridKey(cell_x, cell_y)); cell != grid_.end()) {
+        for (const auto index : cell->second) {
+          const auto position = entries_[index].second.getMapPose().position;
+          if (std::hypot(position.x - point.x, position.y - point.y) <= radius) {
+            ret.push_back(index);
+          }
+        }
+      }
+    }
+  }
+  std::sort(ret.begin(), ret.end());
+  return ret;
+}
+
+auto EntityStatusSnapshot::indicesOnLanelets(const std::vector<std::int64_t> & lanelet_ids) const
+  -> std::vector<std::size_t>
+{
+  std::vector<std::size_t> ret;
+  for (const auto lanelet_id : lanelet_ids) {
+    if (const auto bucket = lanelet_buckets_.find(lanelet_id); bucket != lanelet_buckets_.end()) {
+      ret.insert(ret.end(), bucket->second.begin(), bucket->second.end());
+    }
+  }
+  std::sort(ret.begin(), ret.end());
+  ret.erase(std::unique(ret.begin(), ret.end()), ret.end());
+  return ret;
+}
+
+auto EntityStatusSnapshot::indicesOnLanelet(std::int64_t lanelet_id) const
+  -> const std::vector<std::size_t> &
+{
+  static const std::vector<std::size_t> empty;
+  if (const auto bucket = lanelet_buckets_.find(lanelet_id); bucket != lanelet_buckets_.end()) {
+    return bucket->second;
+  }
+  return empty;
+}
+
+auto EntityStatusSnapshot::toGridCell(double x, double y) -> std::pair<std::int64_t, std::int64_t>
+{
+  return {
+    static_cast<std::int64_t>(std::floor(x / grid_cell_size)),
+    static_cast<std::int64_t>(std::floor(y / grid_cell_size))};
+}
+
+auto EntityStatusSnapshot::toGridKey(std::int64_t cell_x, std::int64_t cell_y) -> std::int64_t
+{
+  return static_cast<std::int64_t>(
+    (static_cast<std::uint64_t>(cell_x) << 32) ^ (static_cast<std::uint64_t>(cell_y) & 0xFFFFFFFF));
+}
+
+auto EntityStatusSnapshot::indexOf(const std::string & name) const -> std::optional<std::size_t>
+{
+  if (const auto index = indices_.find(name);
+      index != indices_.end() and index->second != unused_index) {
+    return index->second;
+  }
+  return std::nullopt;
+}
+
+auto EntityStatusSnapshot::find(const std::string & name) const -> const_iterator
+{
+  if (const auto index = indexOf(name)) {
+    return entries_.begin() + index.value();
+  }
+  return entries_.end();
+}
+
+auto EntityStatusSnapshot::at(const std::string & name) const -> const CanonicalizedEntityStatus &
+{
+  if (const auto index = indexOf(name)) {
+    return entries_[index.value()].second;
+  }
+  THROW_SIMULATION_ERROR("entity : ", name, " does not exist in the entity status snapshot.");
+}
+
+auto EntityStatusSnapshotPool::acquire() -> std::shared_ptr<EntityStatusSnapshot>
+{
+  for (const auto & snapshot : snapshots_) {
+    if (snapshot.use_count() == 1) {
+      snapshot->clear();
+      return snapshot;
+    }
+  }
+  return snapshots_.emplace_back(std::make_shared<EntityStatusSnapshot>());
+}
+
+OtherEntityStatusView::OtherEntityStatusView()
+: OtherEntityStatusView(
+    []() {
+      static const auto empty_snapshot = std::make_shared<const EntityStatusSnapshot>();
+      return empty_snapshot;
+    }(),
+    "")
+{
+}
+
+OtherEntityStatusView::OtherEntityStatusView(
+  const std::shared_ptr<const EntityStatusSnapshot> & snapshot, const std::string & owner_name)
+: snapshot_(snapshot), owner_index_(snapshot->indexOf(owner_name).value_or(snapshot->size()))
+{
+}
+
+auto OtherEntityStatusView::begin() const -> const_iterator
+{
+  return const_iterator(snapshot_->begin(), snapshot_->begin() + owner_index_, snapshot_->end());
+}
+
+auto OtherEntityStatusView::end() const -> const_iterator
+{
+  return const_iterator(snapshot_->end(), snapshot_->begin() + owner_index_, snapshot_->end());
+}
+
+auto OtherEntityStatusView::size() const -> std::size_t
+{
+  return owner_index_ < snapshot_->size() ? snapshot_->size() - 1 : snapshot_->size();
+}
+
+auto OtherEntityStatusView::count(const std::string & name) const -> std::size_t
+{
+  return find(name) == end() ? 0 : 1;
+}
+
+auto OtherEntityStatusView::find(const std::string & name) const -> const_iterator
+{
+  if (const auto index = snapshot_->indexOf(name); index and index.value() != owner_index_) {
+    return const_iterator(
+      snapshot_->begin() + index.value(), snapshot_->begin() + owner_index_, snapshot_->end());
+  }
+  return end();
+}
+
+auto OtherEntityStatusView::getEntitiesWithin(
+  const geometry_msgs::msg::Point & point, double radius) const -> std::vector<const value_type *>
+{
+  return getEntities(snapshot_->indicesWithin(point, radius));
+}
+
+auto OtherEntityStatusView::getEntitiesOnLanelets(
+  const std::vector<std::int64_t> & lanelet_ids) const -> std::vector<const value_type *>
+{
+  return getEntities(snapshot_->indicesOnLanelets(lanelet_ids));
+}
+
+auto OtherEntityStatusView::existsOnLanelets(const std::vector<std::int64_t> & lanelet_ids) const
+  -> bool
+{
+  return std::any_of(lanelet_ids.begin(), lanelet_ids.end(), [this](const auto lanelet_id) {
+    const auto & indices = snapshot_->indicesOnLanelet(lanelet_id);
+    return std::any_of(indices.begin(), indices.end(), [this](const auto index) {
+      return index != owner_index_;
+    });
+  });
+}
+
+auto OtherEntityStatusView::getEntities(const std::vector<std::size_t> & indices) const
+  -> std::vector<const value_type *>
+{
+  std::vector<const value_type *> ret;
+  ret.reserve(indices.size());
+  for (const auto index : indices) {
+    if (index != owner_index_) {
+      ret.push_back(&(*snapshot_)[index]);
+    }
+  }
+  return ret;
+}
+
+auto OtherEntityStatusView::at(const std::string & name) const -> const CanonicalizedEntityStatus &
+{
+  if (const auto iter = find(name); iter != end()) {
+    return iter->second;
+  }
+  THROW_SIMULATION_ERROR("other entity : ", name, " does not exist.");
+}
+}  // namespace traffic_simulator
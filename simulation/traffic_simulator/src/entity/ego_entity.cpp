@@ -80,8 +80,11 @@ EgoEntity::EgoEntity(
   const std::string & name, const CanonicalizedEntityStatus & entity_status,
   const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils_ptr,
   const traffic_simulator_msgs::msg::VehicleParameters & parameters,
-  const Configuration & configuration)
-: VehicleEntity(name, entity_status, hdmap_utils_ptr, parameters),
+  const Configuration & configuration,
+  const std::shared_ptr<BehaviorPluginPool> & behavior_plugin_pool)
+: VehicleEntity(
+    name, entity_status, hdmap_utils_ptr, parameters, BuiltinBehavior::defaultBehavior(),
+    behavior_plugin_pool),
   field_operator_application(makeFieldOperatorApplication(configuration)),
   externally_updated_status_(entity_status)
 {
@@ -227,6 +230,14 @@ auto EgoEntity::requestLaneChange(const traffic_simulator::lane_change::Paramete
     "everything but their destination");
 }
 
+auto EgoEntity::requestReplayTrajectory(
+  const std::shared_ptr<const replay_trajectory::Trajectory> &) -> void
+{
+  THROW_SEMANTIC_ERROR(
+    "From scenario, a trajectory replay was requested to Ego type entity ", std::quoted(name),
+    " In general, such a request is an error, since Ego cars are driven by Autoware");
+}
+
 auto EgoEntity::requestSpeedChange(
   const double target_speed, const speed_change::Transition, const speed_change::Constraint,
   const bool) -> void
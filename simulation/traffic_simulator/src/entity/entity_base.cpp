@@ -35,7 +35,8 @@ EntityBase::EntityBase(
   status_(entity_status),
   status_before_update_(status_),
   hdmap_utils_ptr_(hdmap_utils_ptr),
-  npc_logic_started_(false)
+  npc_logic_started_(false),
+  speed_planner_(0.0, name)
 {
   if (name != static_cast<EntityStatus>(entity_status).name) {
     THROW_SIMULATION_ERROR(
@@ -259,7 +260,7 @@ auto EntityBase::getMapPoseFromRelativePose(const geometry_msgs::msg::Pose & rel
 
 auto EntityBase::isTargetSpeedReached(double target_speed) const -> bool
 {
-  return speed_planner_->isTargetSpeedReached(target_speed, getCurrentTwist());
+  return speed_planner_.isTargetSpeedReached(target_speed, getCurrentTwist());
 }
 
 auto EntityBase::isTargetSpeedReached(const speed_change::RelativeTargetSpeed & target_speed) const
@@ -272,9 +273,7 @@ void EntityBase::onUpdate(double /*current_time*/, double step_time)
 {
   job_list_.update(step_time, job::Event::PRE_UPDATE);
   status_before_update_ = status_;
-  speed_planner_ =
-    std::make_unique<traffic_simulator::longitudinal_speed_planning::LongitudinalSpeedPlanner>(
-      step_time, name);
+  speed_planner_.setStepTime(step_time);
 }
 
 void EntityBase::onPostUpdate(double /*current_time*/, double step_time)
@@ -282,6 +281,29 @@ void EntityBase::onPostUpdate(double /*current_time*/, double step_time)
   job_list_.update(step_time, job::Event::POST_UPDATE);
 }
 
+auto EntityBase::updateReplayedStatus(double step_time) -> bool
+{
+  if (not replay_trajectory_cursor_) {
+    return false;
+  } else if (auto updated_status = replay_trajectory_cursor_->makeUpdatedStatus(
+               static_cast<EntityStatus>(status_), step_time)) {
+    if (
+      const auto lanelet_pose = hdmap_utils_ptr_->toLaneletPose(
+        updated_status->pose, getBoundingBox(),
+        getEntityType().type == traffic_simulator_msgs::msg::EntityType::PEDESTRIAN, 1.0)) {
+      updated_status->lanelet_pose = lanelet_pose.value();
+      updated_status->lanelet_pose_valid = true;
+    }
+    setStatus(CanonicalizedEntityStatus(updated_status.value(), hdmap_utils_ptr_));
+    updateStandStillDuration(step_time);
+    updateTraveledDistance(step_time);
+    return true;
+  } else {
+    replay_trajectory_cursor_ = std::nullopt;
+    return false;
+  }
+}
+
 void EntityBase::resetDynamicConstraints()
 {
   setDynamicConstraints(getDefaultDynamicConstraints());
@@ -350,7 +372,7 @@ void EntityBase::requestSpeedChangeWithConstantAcceleration(
       break;
     }
     case speed_change::Transition::AUTO: {
-      if (speed_planner_->isAccelerating(target_speed, getCurrentTwist())) {
+      if (speed_planner_.isAccelerating(target_speed, getCurrentTwist())) {
         setAccelerationLimit(std::abs(acceleration));
         job_list_.append(
           /**
@@ -362,7 +384,7 @@ void EntityBase::requestSpeedChangeWithConstantAcceleration(
            */
           [this]() { resetDynamicConstraints(); }, job::Type::LINEAR_ACCELERATION, true,
           job::Event::POST_UPDATE);
-      } else if (speed_planner_->isDecelerating(target_speed, getCurrentTwist())) {
+      } else if (speed_planner_.isDecelerating(target_speed, getCurrentTwist())) {
         setDecelerationLimit(std::abs(acceleration));
         job_list_.append(
           /**
@@ -407,7 +429,7 @@ void EntityBase::requestSpeedChangeWithTimeConstraint(
       break;
     }
     case speed_change::Transition::AUTO: {
-      setDynamicConstraints(speed_planner_->planConstraintsFromJerkAndTimeConstraint(
+      setDynamicConstraints(speed_planner_.planConstraintsFromJerkAndTimeConstraint(
         target_speed, getCurrentTwist(), getCurrentAccel(), acceleration_time,
         getDynamicConstraints()));
       job_list_.append(
@@ -659,6 +681,12 @@ auto EntityBase::requestFollowTrajectory(
     getEntityTypename(), " type entities do not support follow trajectory action.");
 }
 
+auto EntityBase::requestReplayTrajectory(
+  const std::shared_ptr<const replay_trajectory::Trajectory> &) -> void
+{
+  THROW_SEMANTIC_ERROR(getEntityTypename(), " type entities do not support replaying trajectory.");
+}
+
 void EntityBase::requestWalkStraight()
 {
   THROW_SEMANTIC_ERROR(getEntityTypename(), " type entities do not support WalkStraightAction");
@@ -673,33 +701,21 @@ void EntityBase::setDynamicConstraints(
 }
 
 void EntityBase::setEntityTypeList(
-  const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> & entity_type_list)
+  const std::shared_ptr<
+    const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>> &
+    entity_type_list)
 {
   entity_type_list_ = entity_type_list;
 }
 
-void EntityBase::setOtherStatus(
-  const std::unordered_map<std::string, CanonicalizedEntityStatus> & status)
-{
-  other_status_.clear();
-  for (const auto & [other_name, other_status] : status) {
-    if (other_name != name) {
-      /*
-         The following filtering is the code written for the purpose of
-         reducing the calculation load, but it is commented out experimentally
-         because it adversely affects "processing that needs to identify other
-         entities regardless of distance" such as RelativeTargetSpeed of
-         requestSpeedChange.
-      */
-      // const auto p0 = other_status.pose.position;
-      // const auto p1 = status_.pose.position;
-      // if (const auto distance = std::hypot(p0.x - p1.x, p0.y - p1.y, p0.z - p1.z); distance <
-      // 30)
-      // {
-      other_status_.emplace(other_name, other_status);
-      // }
-    }
-  }
+void EntityBase::setOtherStatus(const std::shared_ptr<const EntityStatusSnapshot> & snapshot)
+{
+  /*
+     Filtering other entities by distance to reduce the calculation load is not done here,
+     because it adversely affects "processing that needs to identify other entities regardless
+     of distance" such as RelativeTargetSpeed of requestSpeedChange.
+  */
+  other_status_ = OtherEntityStatusView(snapshot, name);
 }
 
 auto EntityBase::setStatus(const CanonicalizedEntityStatus & status) -> void
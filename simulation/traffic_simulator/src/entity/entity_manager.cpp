@@ -12,11 +12,14 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <cstdint>
 #include <geometry/bounding_box.hpp>
 #include <geometry/distance.hpp>
 #include <geometry/intersection/collision.hpp>
 #include <geometry/transform.hpp>
+#include <iostream>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <optional>
@@ -29,14 +32,29 @@
 #include <traffic_simulator/helper/helper.hpp>
 #include <traffic_simulator/helper/stop_watch.hpp>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace traffic_simulator
 {
 namespace entity
 {
+EntityManager::~EntityManager()
+{
+  if (not behavior_tick_profile_path_.empty()) {
+    try {
+      behavior::TickProfiler::get().dump(behavior_tick_profile_path_);
+    } catch (const common::SimulationError & error) {
+      std::cerr << error.what() << std::endl;
+    }
+  }
+}
+
 void EntityManager::broadcastEntityTransform()
 {
+  if (not publishing_frame_) {
+    return;
+  }
   std::vector<std::string> names = getEntityNames();
   for (const auto & name : names) {
     geometry_msgs::msg::PoseStamped pose;
@@ -70,9 +88,135 @@ void EntityManager::broadcastTransform(
 
 bool EntityManager::checkCollision(const std::string & name0, const std::string & name1)
 {
-  return name0 != name1 and
-         math::geometry::checkCollision2D(
-           getMapPose(name0), getBoundingBox(name0), getMapPose(name1), getBoundingBox(name1));
+  return name0 != name1 and checkCollision(getEntityHandle(name0), getEntityHandle(name1));
+}
+
+auto EntityManager::checkCollision(const EntityHandle & handle0, const EntityHandle & handle1) const
+  -> bool
+{
+  if (handle0 == handle1) {
+    return false;
+  } else {
+    const auto & entity0 = resolve(handle0);
+    const auto & entity1 = resolve(handle1);
+    return math::geometry::checkCollision2D(
+      entity0.getMapPose(), entity0.getBoundingBox(), entity1.getMapPose(),
+      entity1.getBoundingBox());
+  }
+}
+
+auto EntityManager::getCollidingEntities(const std::string & name) const
+  -> std::vector<std::string>
+{
+  std::vector<std::string> ret;
+  if (const auto iter = entity_handles_.find(name); iter != entity_handles_.end()) {
+    const auto & handle = iter->second;
+    const auto & slot = entity_slots_[handle.index];
+    if (slot.moved) {
+      for (const auto & [other_name, other_handle] : entity_handles_) {
+        if (checkCollision(handle, other_handle)) {
+          ret.push_back(other_name);
+        }
+      }
+    } else {
+      for (const auto & other : slot.colliding_entities) {
+        if (entityExists(other) and not entity_slots_[other.index].moved) {
+          ret.push_back(resolve(other).name);
+        }
+      }
+      for (const auto & other : moved_entities_) {
+        if (entityExists(other) and checkCollision(handle, other)) {
+          ret.push_back(resolve(other).name);
+        }
+      }
+    }
+    std::sort(ret.begin(), ret.end());
+  }
+  return ret;
+}
+
+auto EntityManager::markMoved(const EntityHandle & handle) -> void
+{
+  if (auto & slot = entity_slots_[handle.index]; not slot.moved) {
+    slot.moved = true;
+    moved_entities_.push_back(handle);
+  }
+}
+
+auto EntityManager::updateCollidingEntities() -> void
+{
+  /**
+   * @note Broad phase by sweep and prune along the x axis over the axis aligned bounding boxes of
+   * the entities, then narrow phase by checkCollision2D only for the overlapping boxes.
+   */
+  struct AxisAlignedBoundingBox
+  {
+    const std::string * name;
+    EntityHandle handle;
+    geometry_msgs::msg::Pose pose;
+    traffic_simulator_msgs::msg::BoundingBox bounding_box;
+    double min_x = std::numeric_limits<double>::max();
+    double max_x = std::numeric_limits<double>::lowest();
+    double min_y = std::numeric_limits<double>::max();
+    double max_y = std::numeric_limits<double>::lowest();
+  };
+  std::vector<AxisAlignedBoundingBox> boxes;
+  boxes.reserve(entity_handles_.size());
+  for (const auto & [name, handle] : entity_handles_) {
+    const auto & entity = resolve(handle);
+    AxisAlignedBoundingBox box;
+    box.name = &name;
+    box.handle = handle;
+    box.pose = entity.getMapPose();
+    box.bounding_box = entity.getBoundingBox();
+    for (const auto & point : math::geometry::transformPoints(
+           box.pose, math::geometry::getPointsFromBbox(box.bounding_box))) {
+      box.min_x = std::min(box.min_x, point.x);
+      box.max_x = std::max(box.max_x, point.x);
+      box.min_y = std::min(box.min_y, point.y);
+      box.max_y = std::max(box.max_y, point.y);
+    }
+    boxes.push_back(box);
+  }
+  std::sort(boxes.begin(), boxes.end(), [](const auto & a, const auto & b) {
+    return a.min_x < b.min_x;
+  });
+  std::vector<std::vector<std::pair<const std::string *, EntityHandle>>> colliding_entities(
+    entity_slots_.size());
+  for (auto a = boxes.begin(); a != boxes.end(); ++a) {
+    for (auto b = std::next(a); b != boxes.end() and b->min_x <= a->max_x; ++b) {
+      if (
+        a->min_y <= b->max_y and b->min_y <= a->max_y and
+        math::geometry::checkCollision2D(a->pose, a->bounding_box, b->pose, b->bounding_box)) {
+        colliding_entities[a->handle.index].emplace_back(b->name, b->handle);
+        colliding_entities[b->handle.index].emplace_back(a->name, a->handle);
+      }
+    }
+  }
+  for (const auto & box : boxes) {
+    auto & others = colliding_entities[box.handle.index];
+    std::sort(others.begin(), others.end(), [](const auto & a, const auto & b) {
+      return *a.first < *b.first;
+    });
+    auto & slot = entity_slots_[box.handle.index];
+    if (configuration.verbose) {
+      for (const auto & [other_name, other] : others) {
+        if (
+          *box.name < *other_name and
+          std::find(slot.colliding_entities.begin(), slot.colliding_entities.end(), other) ==
+            slot.colliding_entities.end()) {
+          std::cout << "collision between " << *box.name << " and " << *other_name << " at "
+                    << current_time_ << std::endl;
+        }
+      }
+    }
+    slot.colliding_entities.clear();
+    for (const auto & other : others) {
+      slot.colliding_entities.push_back(other.second);
+    }
+    slot.moved = false;
+  }
+  moved_entities_.clear();
 }
 
 visualization_msgs::msg::MarkerArray EntityManager::makeDebugMarker() const
@@ -84,8 +228,50 @@ visualization_msgs::msg::MarkerArray EntityManager::makeDebugMarker() const
   return marker;
 }
 
+auto EntityManager::makeDebugMarkerDifference(bool reset) -> visualization_msgs::msg::MarkerArray
+{
+  visualization_msgs::msg::MarkerArray difference;
+  if (reset) {
+    visualization_msgs::msg::Marker delete_all;
+    delete_all.action = visualization_msgs::msg::Marker::DELETEALL;
+    difference.markers.push_back(delete_all);
+    published_debug_markers_.clear();
+  }
+  const auto equalsIgnoringStamp = [](auto lhs, const auto & rhs) {
+    lhs.header.stamp = rhs.header.stamp;
+    return lhs == rhs;
+  };
+  auto previous = std::exchange(published_debug_markers_, {});
+  for (const auto & marker : makeDebugMarker().markers) {
+    if (marker.action != visualization_msgs::msg::Marker::ADD) {
+      difference.markers.push_back(marker);
+      continue;
+    }
+    const auto key = std::make_pair(marker.ns, marker.id);
+    if (const auto iter = previous.find(key); iter == previous.end()) {
+      difference.markers.push_back(marker);
+    } else {
+      if (not equalsIgnoringStamp(iter->second, marker)) {
+        difference.markers.push_back(marker);
+      }
+      previous.erase(iter);
+    }
+    published_debug_markers_.insert_or_assign(key, marker);
+  }
+  for (const auto & [key, marker] : previous) {
+    visualization_msgs::msg::Marker deleted;
+    deleted.header = marker.header;
+    deleted.ns = marker.ns;
+    deleted.id = marker.id;
+    deleted.action = visualization_msgs::msg::Marker::DELETE;
+    difference.markers.push_back(deleted);
+  }
+  return difference;
+}
+
 bool EntityManager::despawnEntity(const std::string & name)
 {
+  unregisterEntity(name);
   return entityExists(name) && entities_.erase(name);
 }
 
@@ -94,11 +280,27 @@ bool EntityManager::entityExists(const std::string & name)
   return entities_.find(name) != std::end(entities_);
 }
 
+auto EntityManager::entityExists(const EntityHandle & handle) const noexcept -> bool
+{
+  return handle.index < entity_slots_.size() and
+         entity_slots_[handle.index].generation == handle.generation and
+         entity_slots_[handle.index].entity;
+}
+
 auto EntityManager::getBoundingBoxDistance(const std::string & from, const std::string & to)
   -> std::optional<double>
 {
+  return getBoundingBoxDistance(getEntityHandle(from), getEntityHandle(to));
+}
+
+auto EntityManager::getBoundingBoxDistance(const EntityHandle & from, const EntityHandle & to) const
+  -> std::optional<double>
+{
+  const auto & from_entity = resolve(from);
+  const auto & to_entity = resolve(to);
   return math::geometry::getPolygonDistance(
-    getMapPose(from), getBoundingBox(from), getMapPose(to), getBoundingBox(to));
+    from_entity.getMapPose(), from_entity.getBoundingBox(), to_entity.getMapPose(),
+    to_entity.getBoundingBox());
 }
 
 auto EntityManager::getCurrentTime() const noexcept -> double { return current_time_; }
@@ -131,6 +333,15 @@ auto EntityManager::getDistanceToStopLine(
   return spline.getCollisionPointIn2D(polygon);
 }
 
+auto EntityManager::getEntityHandle(const std::string & name) const -> EntityHandle
+{
+  if (const auto iter = entity_handles_.find(name); iter == entity_handles_.end()) {
+    THROW_SEMANTIC_ERROR("entity ", std::quoted(name), " does not exist.");
+  } else {
+    return iter->second;
+  }
+}
+
 auto EntityManager::getEntityNames() const -> const std::vector<std::string>
 {
   std::vector<std::string> names{};
@@ -140,6 +351,18 @@ auto EntityManager::getEntityNames() const -> const std::vector<std::string>
   return names;
 }
 
+auto EntityManager::getEntityNames(const traffic_simulator_msgs::msg::EntityType & type) const
+  -> const std::vector<std::string> &
+{
+  static const std::vector<std::string> empty;
+  if (const auto iter = entity_names_by_type_.find(type.type);
+      iter != entity_names_by_type_.end()) {
+    return iter->second;
+  } else {
+    return empty;
+  }
+}
+
 auto EntityManager::getEntityStatus(const std::string & name) const -> CanonicalizedEntityStatus
 {
   if (const auto iter = entities_.find(name); iter == entities_.end()) {
@@ -154,13 +377,9 @@ auto EntityManager::getEntityStatus(const std::string & name) const -> Canonical
 }
 
 auto EntityManager::getEntityTypeList() const
-  -> const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>
+  -> const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> &
 {
-  std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> ret;
-  for (auto && [name, entity] : entities_) {
-    ret.emplace(name, getEntityType(name));
-  }
-  return ret;
+  return entity_type_list_;
 }
 
 auto EntityManager::getHdmapUtils() -> const std::shared_ptr<hdmap_utils::HdMapUtils> &
@@ -361,20 +580,12 @@ auto EntityManager::getLongitudinalDistance(
   }
 }
 
-auto EntityManager::getNumberOfEgo() const -> std::size_t
-{
-  return std::count_if(std::begin(entities_), std::end(entities_), [this](const auto & each) {
-    return isEgo(each.first);
-  });
-}
+auto EntityManager::getNumberOfEgo() const -> std::size_t { return ego_handle_ ? 1 : 0; }
 
 const std::string EntityManager::getEgoName() const
 {
-  const auto names = getEntityNames();
-  for (const auto & name : names) {
-    if (isEgo(name)) {
-      return name;
-    }
+  if (ego_handle_) {
+    return resolve(ego_handle_.value()).name;
   }
   THROW_SEMANTIC_ERROR(
     "const std::string EntityManager::getEgoName(const std::string & name) function was called, "
@@ -441,6 +652,12 @@ auto EntityManager::getRelativePose(
   return getRelativePose(toMapPose(from), getMapPose(to));
 }
 
+auto EntityManager::getRelativePose(const EntityHandle & from, const EntityHandle & to) const
+  -> geometry_msgs::msg::Pose
+{
+  return getRelativePose(resolve(from).getMapPose(), resolve(to).getMapPose());
+}
+
 auto EntityManager::getStepTime() const noexcept -> double { return step_time_; }
 
 auto EntityManager::getWaypoints(const std::string & name)
@@ -454,21 +671,16 @@ auto EntityManager::getWaypoints(const std::string & name)
 
 bool EntityManager::isEgo(const std::string & name) const
 {
-  using traffic_simulator_msgs::msg::EntityType;
-  return getEntityType(name).type == EntityType::EGO and
-         dynamic_cast<EgoEntity const *>(entities_.at(name).get());
+  return isEgo(getEntityHandle(name));
 }
 
-bool EntityManager::isEgoSpawned() const
+auto EntityManager::isEgo(const EntityHandle & handle) const noexcept -> bool
 {
-  for (const auto & name : getEntityNames()) {
-    if (isEgo(name)) {
-      return true;
-    }
-  }
-  return false;
+  return ego_handle_ == handle;
 }
 
+bool EntityManager::isEgoSpawned() const { return ego_handle_.has_value(); }
+
 bool EntityManager::isInLanelet(
   const std::string & name, const std::int64_t lanelet_id, const double tolerance)
 {
@@ -585,6 +797,7 @@ auto EntityManager::setEntityStatus(
       " after starting scenario.");
   } else {
     entities_.at(name)->setStatus(status);
+    markMoved(getEntityHandle(name));
   }
 }
 
@@ -597,6 +810,7 @@ auto EntityManager::setEntityStatusExternally(
       std::quoted(name), ".");
   } else {
     dynamic_cast<EgoEntity *>(entities_[name].get())->setStatusExternally(status);
+    markMoved(getEntityHandle(name));
   }
 }
 
@@ -614,17 +828,20 @@ auto EntityManager::toMapPose(const CanonicalizedLaneletPose & lanelet_pose) con
   return static_cast<geometry_msgs::msg::Pose>(lanelet_pose);
 }
 
-auto EntityManager::updateNpcLogic(
-  const std::string & name,
-  const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> & type_list)
-  -> const CanonicalizedEntityStatus &
+auto EntityManager::updateNpcLogic(const std::string & name) -> const CanonicalizedEntityStatus &
 {
   if (configuration.verbose) {
     std::cout << "update " << name << " behavior" << std::endl;
   }
-  entities_[name]->setEntityTypeList(type_list);
-  entities_[name]->onUpdate(current_time_, step_time_);
-  return entities_[name]->getStatus();
+  const auto & entity = entities_.at(name);
+  if (not shared_entity_type_list_) {
+    shared_entity_type_list_ = std::make_shared<
+      const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>>(
+      entity_type_list_);
+  }
+  entity->setEntityTypeList(shared_entity_type_list_);
+  entity->onUpdate(current_time_, step_time_);
+  return entity->getStatus();
 }
 
 void EntityManager::update(const double current_time, const double step_time)
@@ -633,46 +850,45 @@ void EntityManager::update(const double current_time, const double step_time)
     "EntityManager::update", configuration.verbose);
   step_time_ = step_time;
   current_time_ = current_time;
+  publishing_frame_ = frame_++ % std::max<std::size_t>(configuration.publish_decimation, 1) == 0;
   setVerbose(configuration.verbose);
   if (npc_logic_started_) {
     conventional_traffic_light_updater_.createTimer(
       configuration.conventional_traffic_light_publish_rate);
     v2i_traffic_light_updater_.createTimer(configuration.v2i_traffic_light_publish_rate);
   }
-  auto type_list = getEntityTypeList();
-  std::unordered_map<std::string, CanonicalizedEntityStatus> all_status;
-  for (auto && [name, entity] : entities_) {
-    all_status.emplace(name, entity->getStatus());
-  }
-  for (auto && [name, entity] : entities_) {
-    entity->setOtherStatus(all_status);
-  }
-  all_status.clear();
+  const auto current_status = entity_status_snapshot_pool_.acquire();
   for (auto && [name, entity] : entities_) {
-    all_status.emplace(name, updateNpcLogic(name, type_list));
+    current_status->emplace(name, entity->getStatus());
   }
+  publishEntityStatus(current_status);
+  const auto updated_status = entity_status_snapshot_pool_.acquire();
   for (auto && [name, entity] : entities_) {
-    entity->setOtherStatus(all_status);
-  }
-  traffic_simulator_msgs::msg::EntityStatusWithTrajectoryArray status_array_msg;
-  for (auto && [name, status] : all_status) {
-    traffic_simulator_msgs::msg::EntityStatusWithTrajectory status_with_trajectory;
-    status_with_trajectory.waypoint = getWaypoints(name);
-    for (const auto & goal : getGoalPoses<geometry_msgs::msg::Pose>(name)) {
-      status_with_trajectory.goal_pose.push_back(goal);
-    }
-    if (const auto obstacle = getObstacle(name); obstacle) {
-      status_with_trajectory.obstacle = obstacle.value();
-      status_with_trajectory.obstacle_find = true;
-    } else {
-      status_with_trajectory.obstacle_find = false;
+    updated_status->emplace(name, updateNpcLogic(name));
+  }
+  publishEntityStatus(updated_status);
+  if (publishing_frame_ and entity_status_array_pub_ptr_->get_subscription_count() > 0) {
+    traffic_simulator_msgs::msg::EntityStatusWithTrajectoryArray status_array_msg;
+    for (auto && [name, status] : *updated_status) {
+      traffic_simulator_msgs::msg::EntityStatusWithTrajectory status_with_trajectory;
+      status_with_trajectory.waypoint = getWaypoints(name);
+      for (const auto & goal : getGoalPoses<geometry_msgs::msg::Pose>(name)) {
+        status_with_trajectory.goal_pose.push_back(goal);
+      }
+      if (const auto obstacle = getObstacle(name); obstacle) {
+        status_with_trajectory.obstacle = obstacle.value();
+        status_with_trajectory.obstacle_find = true;
+      } else {
+        status_with_trajectory.obstacle_find = false;
+      }
+      status_with_trajectory.status = static_cast<EntityStatus>(status);
+      status_with_trajectory.name = name;
+      status_with_trajectory.time = current_time + step_time;
+      status_array_msg.data.emplace_back(status_with_trajectory);
     }
-    status_with_trajectory.status = static_cast<EntityStatus>(status);
-    status_with_trajectory.name = name;
-    status_with_trajectory.time = current_time + step_time;
-    status_array_msg.data.emplace_back(status_with_trajectory);
+    entity_status_array_pub_ptr_->publish(status_array_msg);
   }
-  entity_status_array_pub_ptr_->publish(status_array_msg);
+  updateCollidingEntities();
   stop_watch_update.stop();
   if (configuration.verbose) {
     stop_watch_update.print();
@@ -680,6 +896,73 @@ void EntityManager::update(const double current_time, const double step_time)
   current_time_ += step_time;
 }
 
+auto EntityManager::registerEntity(EntityBase & entity) -> EntityHandle
+{
+  const auto & type = entity.getEntityType();
+  entity_type_list_.emplace(entity.name, type);
+  shared_entity_type_list_ = nullptr;
+  entity_names_by_type_[type.type].push_back(entity.name);
+
+  EntityHandle handle;
+  if (free_entity_slots_.empty()) {
+    handle.index = static_cast<std::uint32_t>(entity_slots_.size());
+    entity_slots_.emplace_back();
+  } else {
+    handle.index = free_entity_slots_.back();
+    free_entity_slots_.pop_back();
+  }
+  auto & slot = entity_slots_[handle.index];
+  slot.entity = &entity;
+  handle.generation = slot.generation;
+  entity_handles_.emplace(entity.name, handle);
+  markMoved(handle);
+  if (dynamic_cast<const EgoEntity *>(&entity)) {
+    ego_handle_ = handle;
+  }
+  return handle;
+}
+
+auto EntityManager::unregisterEntity(const std::string & name) -> void
+{
+  if (const auto iter = entity_handles_.find(name); iter != entity_handles_.end()) {
+    auto & slot = entity_slots_[iter->second.index];
+    slot.entity = nullptr;
+    ++slot.generation;
+    slot.colliding_entities.clear();
+    slot.moved = false;
+    free_entity_slots_.push_back(iter->second.index);
+    if (ego_handle_ == iter->second) {
+      ego_handle_ = std::nullopt;
+    }
+    entity_handles_.erase(iter);
+  }
+  if (const auto type = entity_type_list_.find(name); type != entity_type_list_.end()) {
+    auto & names = entity_names_by_type_[type->second.type];
+    names.erase(std::remove(names.begin(), names.end(), name), names.end());
+    entity_type_list_.erase(type);
+    shared_entity_type_list_ = nullptr;
+  }
+}
+
+auto EntityManager::resolve(const EntityHandle & handle) const -> EntityBase &
+{
+  if (not entityExists(handle)) {
+    THROW_SEMANTIC_ERROR(
+      "entity handle (index ", handle.index, ", generation ", handle.generation,
+      ") does not refer to an existing entity.");
+  }
+  return *entity_slots_[handle.index].entity;
+}
+
+auto EntityManager::publishEntityStatus(const std::shared_ptr<EntityStatusSnapshot> & snapshot)
+  -> void
+{
+  entity_status_snapshot_ = snapshot;
+  for (auto && [name, entity] : entities_) {
+    entity->setOtherStatus(entity_status_snapshot_);
+  }
+}
+
 void EntityManager::updateHdmapMarker()
 {
   MarkerArray markers;
@@ -28,15 +28,13 @@ PedestrianEntity::PedestrianEntity(
   const std::string & name, const CanonicalizedEntityStatus & entity_status,
   const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils_ptr,
   const traffic_simulator_msgs::msg::PedestrianParameters & parameters,
-  const std::string & plugin_name)
+  const std::string & plugin_name,
+  const std::shared_ptr<BehaviorPluginPool> & behavior_plugin_pool)
 : EntityBase(name, entity_status, hdmap_utils_ptr),
   plugin_name(plugin_name),
-  loader_(pluginlib::ClassLoader<entity_behavior::BehaviorPluginBase>(
-    "traffic_simulator", "entity_behavior::BehaviorPluginBase")),
-  behavior_plugin_ptr_(loader_.createSharedInstance(plugin_name)),
+  behavior_plugin_ptr_(behavior_plugin_pool->acquire(plugin_name, rclcpp::get_logger(name))),
   route_planner_(hdmap_utils_ptr_)
 {
-  behavior_plugin_ptr_->configure(rclcpp::get_logger(name));
   behavior_plugin_ptr_->setPedestrianParameters(parameters);
   behavior_plugin_ptr_->setDebugMarker({});
   behavior_plugin_ptr_->setBehaviorParameter(traffic_simulator_msgs::msg::BehaviorParameter());
@@ -82,6 +80,9 @@ std::string PedestrianEntity::getCurrentAction() const
   if (!npc_logic_started_) {
     return "waiting";
   }
+  if (replay_trajectory_cursor_) {
+    return "replay_trajectory";
+  }
   return behavior_plugin_ptr_->getCurrentAction();
 }
 
@@ -146,10 +147,17 @@ void PedestrianEntity::requestAcquirePosition(const geometry_msgs::msg::Pose & m
   }
 }
 
+auto PedestrianEntity::requestReplayTrajectory(
+  const std::shared_ptr<const replay_trajectory::Trajectory> & trajectory) -> void
+{
+  replay_trajectory_cursor_.emplace(trajectory);
+}
+
 void PedestrianEntity::cancelRequest()
 {
   behavior_plugin_ptr_->setRequest(behavior::Request::NONE);
   route_planner_.cancelRoute();
+  replay_trajectory_cursor_ = std::nullopt;
 }
 
 auto PedestrianEntity::getEntityType() const -> const traffic_simulator_msgs::msg::EntityType &
@@ -232,9 +240,14 @@ auto PedestrianEntity::fillLaneletPose(CanonicalizedEntityStatus & status) -> vo
 void PedestrianEntity::onUpdate(double current_time, double step_time)
 {
   EntityBase::onUpdate(current_time, step_time);
-  if (npc_logic_started_) {
+  if (not npc_logic_started_) {
+    updateEntityStatusTimestamp(current_time);
+  } else if (not updateReplayedStatus(step_time)) {
     behavior_plugin_ptr_->setOtherEntityStatus(other_status_);
-    behavior_plugin_ptr_->setEntityTypeList(entity_type_list_);
+    if (behavior_plugin_entity_type_list_ != entity_type_list_) {
+      behavior_plugin_ptr_->setEntityTypeList(*entity_type_list_);
+      behavior_plugin_entity_type_list_ = entity_type_list_;
+    }
     behavior_plugin_ptr_->setEntityStatus(
       std::make_shared<traffic_simulator::CanonicalizedEntityStatus>(status_));
     behavior_plugin_ptr_->setTargetSpeed(target_speed_);
@@ -253,8 +266,6 @@ void PedestrianEntity::onUpdate(double current_time, double step_time)
     setStatus(*status_updated);
     updateStandStillDuration(step_time);
     updateTraveledDistance(step_time);
-  } else {
-    updateEntityStatusTimestamp(current_time);
   }
   EntityBase::onPostUpdate(current_time, step_time);
 }
@@ -29,14 +29,12 @@ VehicleEntity::VehicleEntity(
   const std::string & name, const CanonicalizedEntityStatus & entity_status,
   const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils_ptr,
   const traffic_simulator_msgs::msg::VehicleParameters & parameters,
-  const std::string & plugin_name)
+  const std::string & plugin_name,
+  const std::shared_ptr<BehaviorPluginPool> & behavior_plugin_pool)
 : EntityBase(name, entity_status, hdmap_utils_ptr),
-  loader_(pluginlib::ClassLoader<entity_behavior::BehaviorPluginBase>(
-    "traffic_simulator", "entity_behavior::BehaviorPluginBase")),
-  behavior_plugin_ptr_(loader_.createSharedInstance(plugin_name)),
+  behavior_plugin_ptr_(behavior_plugin_pool->acquire(plugin_name, rclcpp::get_logger(name))),
   route_planner_(hdmap_utils_ptr_)
 {
-  behavior_plugin_ptr_->configure(rclcpp::get_logger(name));
   behavior_plugin_ptr_->setVehicleParameters(parameters);
   behavior_plugin_ptr_->setDebugMarker({});
   behavior_plugin_ptr_->setBehaviorParameter(traffic_simulator_msgs::msg::BehaviorParameter());
@@ -53,12 +51,15 @@ void VehicleEntity::cancelRequest()
 {
   behavior_plugin_ptr_->setRequest(behavior::Request::NONE);
   route_planner_.cancelRoute();
+  replay_trajectory_cursor_ = std::nullopt;
 }
 
 auto VehicleEntity::getCurrentAction() const -> std::string
 {
   if (not npc_logic_started_) {
     return "waiting";
+  } else if (replay_trajectory_cursor_) {
+    return "replay_trajectory";
   } else {
     return behavior_plugin_ptr_->getCurrentAction();
   }
@@ -130,9 +131,14 @@ auto VehicleEntity::getWaypoints() -> const traffic_simulator_msgs::msg::Waypoin
 void VehicleEntity::onUpdate(double current_time, double step_time)
 {
   EntityBase::onUpdate(current_time, step_time);
-  if (npc_logic_started_) {
+  if (not npc_logic_started_) {
+    updateEntityStatusTimestamp(current_time);
+  } else if (not updateReplayedStatus(step_time)) {
     behavior_plugin_ptr_->setOtherEntityStatus(other_status_);
-    behavior_plugin_ptr_->setEntityTypeList(entity_type_list_);
+    if (behavior_plugin_entity_type_list_ != entity_type_list_) {
+      behavior_plugin_ptr_->setEntityTypeList(*entity_type_list_);
+      behavior_plugin_entity_type_list_ = entity_type_list_;
+    }
     behavior_plugin_ptr_->setEntityStatus(std::make_unique<CanonicalizedEntityStatus>(status_));
     behavior_plugin_ptr_->setTargetSpeed(target_speed_);
 
@@ -140,11 +146,17 @@ void VehicleEntity::onUpdate(double current_time, double step_time)
     behavior_plugin_ptr_->setRouteLanelets(route_lanelets);
 
     // recalculate spline only when input data changes
-    if (previous_route_lanelets_ != route_lanelets) {
+    if (previous_route_lanelets_ == route_lanelets) {
+      reference_trajectory_cache_statistics_.hits++;
+    } else {
+      reference_trajectory_cache_statistics_.misses++;
       previous_route_lanelets_ = route_lanelets;
       try {
-        spline_ = std::make_shared<math::geometry::CatmullRomSpline>(
-          hdmap_utils_ptr_->getCenterPoints(route_lanelets));
+        // the route is usually shifted by a lanelet, so most of the curves of spline_ are reused.
+        spline_ = spline_ ? std::make_shared<math::geometry::CatmullRomSpline>(
+                              hdmap_utils_ptr_->getCenterPoints(route_lanelets), *spline_)
+                          : std::make_shared<math::geometry::CatmullRomSpline>(
+                              hdmap_utils_ptr_->getCenterPoints(route_lanelets));
       } catch (const common::scenario_simulator_exception::SemanticError & error) {
         // reset the ptr when spline cannot be calculated
         spline_.reset();
@@ -165,8 +177,6 @@ void VehicleEntity::onUpdate(double current_time, double step_time)
     setStatus(*status_updated);
     updateStandStillDuration(step_time);
     updateTraveledDistance(step_time);
-  } else {
-    updateEntityStatusTimestamp(current_time);
   }
   EntityBase::onPostUpdate(current_time, step_time);
 }
@@ -227,6 +237,12 @@ auto VehicleEntity::requestFollowTrajectory(
   behavior_plugin_ptr_->setRequest(behavior::Request::FOLLOW_POLYLINE_TRAJECTORY);
 }
 
+auto VehicleEntity::requestReplayTrajectory(
+  const std::shared_ptr<const replay_trajectory::Trajectory> & trajectory) -> void
+{
+  replay_trajectory_cursor_.emplace(trajectory);
+}
+
 void VehicleEntity::requestLaneChange(const std::int64_t to_lanelet_id)
 {
   behavior_plugin_ptr_->setRequest(behavior::Request::LANE_CHANGE);
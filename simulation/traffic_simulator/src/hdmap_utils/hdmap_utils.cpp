@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <lanelet2_core/geometry/BoundingBox.h>
 #include <lanelet2_core/utility/Units.h>
 #include <lanelet2_io/Io.h>
 #include <lanelet2_io/io_handlers/Serialize.h>
@@ -26,7 +27,9 @@
 #include <boost/geometry/geometries/box.hpp>
 #include <boost/geometry/geometries/point_xy.hpp>
 #include <boost/geometry/geometries/polygon.hpp>
+#include <cmath>
 #include <deque>
+#include <exception>
 #include <geometry/linear_algebra.hpp>
 #include <geometry/spline/catmull_rom_spline.hpp>
 #include <geometry/spline/hermite_curve.hpp>
@@ -38,10 +41,12 @@
 #include <lanelet2_extension/utility/utilities.hpp>
 #include <lanelet2_extension/visualization/visualization.hpp>
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <scenario_simulator_exception/exception.hpp>
 #include <set>
 #include <string>
+#include <thread>
 #include <traffic_simulator/color_utils/color_utils.hpp>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
 #include <traffic_simulator/helper/helper.hpp>
@@ -81,8 +86,100 @@ HdMapUtils::HdMapUtils(
   std::vector<lanelet::routing::RoutingGraphConstPtr> all_graphs;
   all_graphs.push_back(vehicle_routing_graph_ptr_);
   all_graphs.push_back(pedestrian_routing_graph_ptr_);
+  routing_graph_container_ptr_ =
+    std::make_shared<const lanelet::routing::RoutingGraphContainer>(all_graphs);
   shoulder_lanelets_ =
     lanelet::utils::query::shoulderLanelets(lanelet::utils::query::laneletLayer(lanelet_map_ptr_));
+  buildTrafficLightAndStopLineIndex();
+  buildConflictTable();
+}
+
+void HdMapUtils::buildConflictTable()
+{
+  /**
+   * @note Only lanelets of the vehicle routing graph are tabulated. Queries about any other lanelet
+   * fall back to calculating the result on demand, so their behavior is unchanged.
+   */
+  for (const auto & lanelet : vehicle_routing_graph_ptr_->passableSubmap()->laneletLayer) {
+    conflicting_lane_ids_.emplace(lanelet.id(), calculateConflictingLaneIds(lanelet.id()));
+    const auto crosswalk_ids = calculateConflictingCrosswalkIds(lanelet.id());
+    for (const auto crosswalk_id : crosswalk_ids) {
+      collision_points_in_lane_coordinate_.emplace(
+        std::make_pair(lanelet.id(), crosswalk_id),
+        calculateCollisionPointInLaneCoordinate(lanelet.id(), crosswalk_id));
+    }
+    conflicting_crosswalk_ids_.emplace(lanelet.id(), crosswalk_ids);
+  }
+}
+
+void HdMapUtils::buildTrafficLightAndStopLineIndex()
+{
+  const auto traffic_light_id_of = [](const auto & light_bulbs) -> std::optional<std::int64_t> {
+    if (light_bulbs.hasAttribute("traffic_light_id")) {
+      if (const auto id = light_bulbs.attribute("traffic_light_id").asId()) {
+        return id.value();
+      }
+    }
+    return std::nullopt;
+  };
+
+  for (const auto & light :
+       lanelet::utils::query::autowareTrafficLights(
+         lanelet::utils::query::laneletLayer(lanelet_map_ptr_))) {
+    for (const auto & light_bulbs : light->lightBulbs()) {
+      if (const auto id = traffic_light_id_of(light_bulbs)) {
+        traffic_light_ids_.emplace_back(id.value());
+        traffic_lights_[id.value()].emplace_back(light);
+        auto & stop_lines_points = traffic_light_stop_lines_points_[id.value()];
+        stop_lines_points.emplace_back();
+        if (const auto stop_line = light->stopLine()) {
+          stop_lines_points.back() = toPolygon(stop_line.value());
+        }
+        auto & bulb_positions = traffic_light_bulb_positions_[id.value()];
+        for (const auto & bulb : static_cast<lanelet::ConstLineString3d>(light_bulbs)) {
+          if (bulb.hasAttribute("color") and !bulb.hasAttribute("arrow")) {
+            geometry_msgs::msg::Point point;
+            point.x = bulb.x();
+            point.y = bulb.y();
+            point.z = bulb.z();
+            /// @note If several bulbs have the same color, the first one is used.
+            bulb_positions.emplace(bulb.attribute("color").value(), point);
+          }
+        }
+      }
+    }
+  }
+
+  for (const auto & regulatory_element : lanelet_map_ptr_->regulatoryElementLayer) {
+    if (
+      regulatory_element->hasAttribute(lanelet::AttributeName::Subtype) and
+      regulatory_element->attribute(lanelet::AttributeName::Subtype).value() == "traffic_light") {
+      for (const auto & ref_member :
+           regulatory_element->getParameters<lanelet::ConstLineString3d>("refers")) {
+        traffic_light_regulatory_element_ids_[ref_member.id()].push_back(regulatory_element->id());
+      }
+    }
+  }
+
+  for (const auto & lanelet : lanelet_map_ptr_->laneletLayer) {
+    auto & traffic_light_ids = traffic_light_ids_on_lanelet_[lanelet.id()];
+    for (const auto & traffic_light :
+         lanelet.regulatoryElementsAs<const lanelet::autoware::AutowareTrafficLight>()) {
+      for (const auto & light_bulbs : traffic_light->lightBulbs()) {
+        if (const auto id = traffic_light_id_of(light_bulbs)) {
+          traffic_light_ids.emplace_back(id.value());
+        }
+      }
+    }
+    auto & stop_lines = stop_lines_on_lanelet_[lanelet.id()];
+    for (const auto & traffic_sign : lanelet.regulatoryElementsAs<const lanelet::TrafficSign>()) {
+      if (traffic_sign->type() == "stop_sign") {
+        for (const auto & stop_line : traffic_sign->refLines()) {
+          stop_lines.emplace_back(stop_line);
+        }
+      }
+    }
+  }
 }
 
 auto HdMapUtils::gelAllCanonicalizedLaneletPoses(
@@ -309,7 +406,7 @@ double HdMapUtils::getHeight(const traffic_simulator_msgs::msg::LaneletPose & la
   return toMapPose(lanelet_pose).pose.position.z;
 }
 
-std::optional<double> HdMapUtils::getCollisionPointInLaneCoordinate(
+std::optional<double> HdMapUtils::calculateCollisionPointInLaneCoordinate(
   std::int64_t lanelet_id, std::int64_t crossing_lanelet_id) const
 {
   namespace bg = boost::geometry;
@@ -357,85 +454,128 @@ std::optional<double> HdMapUtils::getCollisionPointInLaneCoordinate(
   return std::nullopt;
 }
 
+std::optional<double> HdMapUtils::getCollisionPointInLaneCoordinate(
+  std::int64_t lanelet_id, std::int64_t crossing_lanelet_id) const
+{
+  if (const auto collision_point =
+        collision_points_in_lane_coordinate_.find({lanelet_id, crossing_lanelet_id});
+      collision_point != collision_points_in_lane_coordinate_.end()) {
+    return collision_point->second;
+  }
+  return calculateCollisionPointInLaneCoordinate(lanelet_id, crossing_lanelet_id);
+}
+
 std::vector<std::int64_t> HdMapUtils::getConflictingLaneIds(
   const std::vector<std::int64_t> & lanelet_ids) const
 {
   std::vector<std::int64_t> ret;
   for (const auto & lanelet_id : lanelet_ids) {
-    const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
-    const auto conflicting_lanelets =
-      lanelet::utils::getConflictingLanelets(vehicle_routing_graph_ptr_, lanelet);
-    for (const auto & conflicting_lanelet : conflicting_lanelets) {
-      ret.emplace_back(conflicting_lanelet.id());
+    if (const auto lane_ids = conflicting_lane_ids_.find(lanelet_id);
+        lane_ids != conflicting_lane_ids_.end()) {
+      ret += lane_ids->second;
+    } else {
+      ret += calculateConflictingLaneIds(lanelet_id);
     }
   }
   return ret;
 }
 
+std::vector<std::int64_t> HdMapUtils::calculateConflictingLaneIds(std::int64_t lanelet_id) const
+{
+  std::vector<std::int64_t> ret;
+  const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
+  const auto conflicting_lanelets =
+    lanelet::utils::getConflictingLanelets(vehicle_routing_graph_ptr_, lanelet);
+  for (const auto & conflicting_lanelet : conflicting_lanelets) {
+    ret.emplace_back(conflicting_lanelet.id());
+  }
+  return ret;
+}
+
 std::vector<std::int64_t> HdMapUtils::getConflictingCrosswalkIds(
   const std::vector<std::int64_t> & lanelet_ids) const
 {
   std::vector<std::int64_t> ret;
-  std::vector<lanelet::routing::RoutingGraphConstPtr> graphs;
-  graphs.emplace_back(vehicle_routing_graph_ptr_);
-  graphs.emplace_back(pedestrian_routing_graph_ptr_);
-  lanelet::routing::RoutingGraphContainer container(graphs);
   for (const auto & lanelet_id : lanelet_ids) {
-    const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
-    double height_clearance = 4;
-    size_t routing_graph_id = 1;
-    const auto conflicting_crosswalks =
-      container.conflictingInGraph(lanelet, routing_graph_id, height_clearance);
-    for (const auto & crosswalk : conflicting_crosswalks) {
-      ret.emplace_back(crosswalk.id());
+    if (const auto crosswalk_ids = conflicting_crosswalk_ids_.find(lanelet_id);
+        crosswalk_ids != conflicting_crosswalk_ids_.end()) {
+      ret += crosswalk_ids->second;
+    } else {
+      ret += calculateConflictingCrosswalkIds(lanelet_id);
     }
   }
   return ret;
 }
 
+std::vector<std::int64_t> HdMapUtils::calculateConflictingCrosswalkIds(
+  std::int64_t lanelet_id) const
+{
+  std::vector<std::int64_t> ret;
+  const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
+  double height_clearance = 4;
+  size_t routing_graph_id = 1;
+  const auto conflicting_crosswalks =
+    routing_graph_container_ptr_->conflictingInGraph(lanelet, routing_graph_id, height_clearance);
+  for (const auto & crosswalk : conflicting_crosswalks) {
+    ret.emplace_back(crosswalk.id());
+  }
+  return ret;
+}
+
 std::vector<geometry_msgs::msg::Point> HdMapUtils::clipTrajectoryFromLaneletIds(
   std::int64_t lanelet_id, double s, const std::vector<std::int64_t> & lanelet_ids,
   double forward_distance) const
 {
-  std::vector<geometry_msgs::msg::Point> ret;
+  return clipTrajectoryViewFromLaneletIds(lanelet_id, s, lanelet_ids, forward_distance).toVector();
+}
+
+PolylineView HdMapUtils::clipTrajectoryViewFromLaneletIds(
+  std::int64_t lanelet_id, double s, const std::vector<std::int64_t> & lanelet_ids,
+  double forward_distance) const
+{
+  /**
+   * @note The points on the lanelets following lanelet_id are sampled at 1m intervals from the
+   * beginning of each lanelet, so they do not depend on s and are cached per lanelet.
+   * Only the points on lanelet_id itself are sampled on each call.
+   */
+  const auto number_of_samples_below = [](double distance) -> std::size_t {
+    return distance > 0 ? static_cast<std::size_t>(std::ceil(distance)) : 0;
+  };
+  PolylineView ret;
   bool on_traj = false;
   double rest_distance = forward_distance;
   for (auto id_itr = lanelet_ids.begin(); id_itr != lanelet_ids.end(); id_itr++) {
     double l = getLaneletLength(*id_itr);
     if (on_traj) {
+      const auto samples = getCenterlineSamples(*id_itr);
       if (rest_distance < l) {
-        for (double s_val = 0; s_val < rest_distance; s_val = s_val + 1.0) {
-          ret.emplace_back(
-            toMapPose(traffic_simulator::helper::constructLaneletPose(*id_itr, s_val, 0))
-              .pose.position);
-        }
+        ret.append(samples, std::min(number_of_samples_below(rest_distance), samples->size()));
         break;
       } else {
         rest_distance = rest_distance - l;
-        for (double s_val = 0; s_val < l; s_val = s_val + 1.0) {
-          ret.emplace_back(
-            toMapPose(traffic_simulator::helper::constructLaneletPose(*id_itr, s_val, 0.0))
-              .pose.position);
-        }
+        ret.append(samples, samples->size());
         continue;
       }
     }
     if (lanelet_id == *id_itr) {
       on_traj = true;
+      auto points = std::make_shared<std::vector<geometry_msgs::msg::Point>>();
       if ((s + forward_distance) < l) {
         for (double s_val = s; s_val < s + forward_distance; s_val = s_val + 1.0) {
-          ret.emplace_back(
+          points->emplace_back(
             toMapPose(traffic_simulator::helper::constructLaneletPose(lanelet_id, s_val, 0.0))
               .pose.position);
         }
+        ret.append(points, points->size());
         break;
       } else {
         rest_distance = rest_distance - (l - s);
         for (double s_val = s; s_val < l; s_val = s_val + 1.0) {
-          ret.emplace_back(
+          points->emplace_back(
             toMapPose(traffic_simulator::helper::constructLaneletPose(lanelet_id, s_val, 0.0))
               .pose.position);
         }
+        ret.append(points, points->size());
         continue;
       }
     }
@@ -443,6 +583,23 @@ std::vector<geometry_msgs::msg::Point> HdMapUtils::clipTrajectoryFromLaneletIds(
   return ret;
 }
 
+std::shared_ptr<const std::vector<geometry_msgs::msg::Point>> HdMapUtils::getCenterlineSamples(
+  std::int64_t lanelet_id) const
+{
+  if (centerline_samples_cache_.exists(lanelet_id)) {
+    return centerline_samples_cache_.getSamples(lanelet_id);
+  }
+  std::vector<geometry_msgs::msg::Point> samples;
+  const double l = getLaneletLength(lanelet_id);
+  for (double s_val = 0; s_val < l; s_val = s_val + 1.0) {
+    samples.emplace_back(
+      toMapPose(traffic_simulator::helper::constructLaneletPose(lanelet_id, s_val, 0.0))
+        .pose.position);
+  }
+  centerline_samples_cache_.appendData(lanelet_id, samples);
+  return centerline_samples_cache_.getSamples(lanelet_id);
+}
+
 std::vector<lanelet::Lanelet> HdMapUtils::filterLanelets(
   const std::vector<lanelet::Lanelet> & lanelets, const char subtype[]) const
 {
@@ -489,11 +646,10 @@ lanelet::BasicPoint2d HdMapUtils::toPoint2d(const geometry_msgs::msg::Point & po
   return lanelet::BasicPoint2d{point.x, point.y};
 }
 
-std::optional<std::int64_t> HdMapUtils::matchToLane(
+lanelet::matching::Object2d HdMapUtils::toObject2d(
   const geometry_msgs::msg::Pose & pose, const traffic_simulator_msgs::msg::BoundingBox & bbox,
-  bool include_crosswalk, double reduction_ratio) const
+  double reduction_ratio) const
 {
-  std::optional<std::int64_t> id;
   lanelet::matching::Object2d obj;
   obj.pose.translation() = toPoint2d(pose.position);
   obj.pose.linear() = Eigen::Rotation2D<double>(
@@ -508,7 +664,24 @@ std::optional<std::int64_t> HdMapUtils::matchToLane(
         bbox.center.x - bbox.dimensions.x * 0.5 * reduction_ratio,
         bbox.center.y - bbox.dimensions.y * 0.5 * reduction_ratio}},
     obj.pose);
-  auto matches = lanelet::matching::getDeterministicMatches(*lanelet_map_ptr_, obj, 3.0);
+  return obj;
+}
+
+std::optional<std::int64_t> HdMapUtils::matchToLane(
+  const geometry_msgs::msg::Pose & pose, const traffic_simulator_msgs::msg::BoundingBox & bbox,
+  bool include_crosswalk, double reduction_ratio) const
+{
+  return matchToLane(
+    pose,
+    lanelet::matching::getDeterministicMatches(
+      *lanelet_map_ptr_, toObject2d(pose, bbox, reduction_ratio), 3.0),
+    include_crosswalk);
+}
+
+std::optional<std::int64_t> HdMapUtils::matchToLane(
+  const geometry_msgs::msg::Pose & pose, std::vector<lanelet::matching::LaneletMatch> matches,
+  bool include_crosswalk) const
+{
   if (!include_crosswalk) {
     matches = lanelet::matching::removeNonRuleCompliantMatches(matches, traffic_rules_vehicle_ptr_);
   }
@@ -538,6 +711,179 @@ std::optional<std::int64_t> HdMapUtils::matchToLane(
   return id_and_distance[0].first;
 }
 
+namespace
+{
+/// @note Interleaves the bits of the quantized x and y coordinates (Z-order curve).
+auto toMortonCode(const geometry_msgs::msg::Point & point, double cell_size) -> std::uint64_t
+{
+  const auto quantize = [cell_size](double value) -> std::uint64_t {
+    return static_cast<std::uint32_t>(
+      static_cast<std::int64_t>(std::floor(value / cell_size)) + (std::int64_t(1) << 31));
+  };
+  const auto spread = [](std::uint64_t value) {
+    value = (value | (value << 16)) & 0x0000FFFF0000FFFF;
+    value = (value | (value << 8)) & 0x00FF00FF00FF00FF;
+    value = (value | (value << 4)) & 0x0F0F0F0F0F0F0F0F;
+    value = (value | (value << 2)) & 0x3333333333333333;
+    value = (value | (value << 1)) & 0x5555555555555555;
+    return value;
+  };
+  return spread(quantize(point.x)) | (spread(quantize(point.y)) << 1);
+}
+}  // namespace
+
+/**
+ * @note Calls function(index, object, matches) for every entity, where matches are equal to
+ * lanelet::matching::getDeterministicMatches(*lanelet_map_ptr_, object, 3.0).
+ * Entities are sorted along a Z-order curve and consecutive entities are grouped into clusters
+ * whose search boxes fit in a square of cluster_size. The R-tree is queried once per cluster and
+ * the candidates are filtered per entity with the same distance as lanelet::geometry::findWithin2d.
+ */
+template <typename Function>
+void HdMapUtils::forEachLaneMatchingCandidates(
+  const std::vector<geometry_msgs::msg::Pose> & poses,
+  const std::vector<traffic_simulator_msgs::msg::BoundingBox> & bboxes, double reduction_ratio,
+  std::size_t thread_count, Function && function) const
+{
+  /**
+   * @note Hard coded parameters. max_matching_distance must be the same value as matchToLane uses.
+   */
+  constexpr double max_matching_distance = 3.0;
+  constexpr double morton_cell_size = 8.0;
+  constexpr double cluster_size = 50.0;
+
+  if (poses.size() != bboxes.size()) {
+    THROW_SIMULATION_ERROR(
+      "size of poses (", poses.size(), ") and bounding boxes (", bboxes.size(),
+      ") should be the same.");
+  }
+
+  std::vector<std::size_t> order(poses.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::vector<std::uint64_t> morton_codes(poses.size());
+  for (std::size_t i = 0; i < poses.size(); ++i) {
+    morton_codes[i] = toMortonCode(poses[i].position, morton_cell_size);
+  }
+  std::sort(order.begin(), order.end(), [&morton_codes](const auto lhs, const auto rhs) {
+    return morton_codes[lhs] < morton_codes[rhs];
+  });
+
+  std::vector<lanelet::matching::Object2d> objects(poses.size());
+  std::vector<lanelet::BoundingBox2d> search_boxes(poses.size());
+  for (std::size_t i = 0; i < poses.size(); ++i) {
+    objects[i] = toObject2d(poses[i], bboxes[i], reduction_ratio);
+    search_boxes[i] = lanelet::geometry::boundingBox2d(objects[i].absoluteHull);
+    search_boxes[i].min().array() -= max_matching_distance;
+    search_boxes[i].max().array() += max_matching_distance;
+  }
+
+  /// @note Each cluster is a range [first, last) of order.
+  std::vector<std::pair<std::size_t, std::size_t>> clusters;
+  for (std::size_t first = 0; first < order.size();) {
+    auto cluster_box = search_boxes[order[first]];
+    auto last = first + 1;
+    for (; last < order.size(); ++last) {
+      auto extended = cluster_box;
+      extended.extend(search_boxes[order[last]]);
+      if ((extended.sizes().array() > cluster_size).any()) {
+        break;
+      }
+      cluster_box = extended;
+    }
+    clusters.emplace_back(first, last);
+    first = last;
+  }
+
+  const auto process_cluster = [&](const auto & cluster) {
+    auto cluster_box = search_boxes[order[cluster.first]];
+    for (auto i = cluster.first + 1; i < cluster.second; ++i) {
+      cluster_box.extend(search_boxes[order[i]]);
+    }
+    const auto candidates = lanelet_map_ptr_->laneletLayer.search(cluster_box);
+    for (auto i = cluster.first; i < cluster.second; ++i) {
+      const auto index = order[i];
+      const auto & hull = objects[index].absoluteHull;
+      std::vector<lanelet::matching::LaneletMatch> matches;
+      for (const auto & candidate : candidates) {
+        if (!lanelet::geometry::intersects(
+              search_boxes[index], lanelet::geometry::boundingBox2d(candidate))) {
+          continue;
+        }
+        if (const auto distance = lanelet::geometry::distance2d(candidate, hull);
+            distance <= max_matching_distance) {
+          lanelet::matching::LaneletMatch match;
+          match.distance = distance;
+          match.lanelet = candidate;
+          matches.push_back(match);
+          match.lanelet = candidate.invert();
+          matches.push_back(match);
+        }
+      }
+      std::sort(matches.begin(), matches.end(), [](const auto & lhs, const auto & rhs) {
+        return lhs.distance < rhs.distance;
+      });
+      function(index, std::move(matches));
+    }
+  };
+
+  if (thread_count <= 1 || clusters.size() <= 1) {
+    for (const auto & cluster : clusters) {
+      process_cluster(cluster);
+    }
+  } else {
+    thread_count = std::min(thread_count, clusters.size());
+    std::vector<std::thread> threads(thread_count);
+    std::vector<std::exception_ptr> exceptions(thread_count);
+    for (std::size_t thread_index = 0; thread_index < thread_count; ++thread_index) {
+      threads[thread_index] = std::thread([&, thread_index]() {
+        try {
+          for (auto i = thread_index; i < clusters.size(); i += thread_count) {
+            process_cluster(clusters[i]);
+          }
+        } catch (...) {
+          exceptions[thread_index] = std::current_exception();
+        }
+      });
+    }
+    for (auto & thread : threads) {
+      thread.join();
+    }
+    for (const auto & exception : exceptions) {
+      if (exception) {
+        std::rethrow_exception(exception);
+      }
+    }
+  }
+}
+
+std::vector<std::optional<std::int64_t>> HdMapUtils::matchToLane(
+  const std::vector<geometry_msgs::msg::Pose> & poses,
+  const std::vector<traffic_simulator_msgs::msg::BoundingBox> & bboxes, bool include_crosswalk,
+  double reduction_ratio, std::size_t thread_count) const
+{
+  std::vector<std::optional<std::int64_t>> ret(poses.size());
+  forEachLaneMatchingCandidates(
+    poses, bboxes, reduction_ratio, thread_count, [&](const auto index, auto && matches) {
+      ret[index] = matchToLane(poses[index], std::move(matches), include_crosswalk);
+    });
+  return ret;
+}
+
+std::vector<std::optional<traffic_simulator_msgs::msg::LaneletPose>> HdMapUtils::toLaneletPose(
+  const std::vector<geometry_msgs::msg::Pose> & poses,
+  const std::vector<traffic_simulator_msgs::msg::BoundingBox> & bboxes, bool include_crosswalk,
+  double matching_distance, std::size_t thread_count) const
+{
+  std::vector<std::optional<traffic_simulator_msgs::msg::LaneletPose>> ret(poses.size());
+  forEachLaneMatchingCandidates(
+    poses, bboxes, 0.8, thread_count, [&](const auto index, auto && matches) {
+      ret[index] = toLaneletPoseFromMatchedLanelet(
+        poses[index], matchToLane(poses[index], std::move(matches), include_crosswalk),
+        include_crosswalk, matching_distance);
+    });
+  return ret;
+}
+
 std::optional<traffic_simulator_msgs::msg::LaneletPose> HdMapUtils::toLaneletPose(
   const geometry_msgs::msg::Pose & pose, bool include_crosswalk, double matching_distance) const
 {
@@ -603,7 +949,15 @@ std::optional<traffic_simulator_msgs::msg::LaneletPose> HdMapUtils::toLaneletPos
   const geometry_msgs::msg::Pose & pose, const traffic_simulator_msgs::msg::BoundingBox & bbox,
   bool include_crosswalk, double matching_distance) const
 {
-  const auto lanelet_id = matchToLane(pose, bbox, include_crosswalk);
+  return toLaneletPoseFromMatchedLanelet(
+    pose, matchToLane(pose, bbox, include_crosswalk), include_crosswalk, matching_distance);
+}
+
+std::optional<traffic_simulator_msgs::msg::LaneletPose>
+HdMapUtils::toLaneletPoseFromMatchedLanelet(
+  const geometry_msgs::msg::Pose & pose, const std::optional<std::int64_t> & lanelet_id,
+  bool include_crosswalk, double matching_distance) const
+{
   if (!lanelet_id) {
     return toLaneletPose(pose, include_crosswalk, matching_distance);
   }
@@ -1062,55 +1416,15 @@ std::vector<std::int64_t> HdMapUtils::getNextLaneletIds(
   return sortAndUnique(ret);
 }
 
-std::vector<std::int64_t> HdMapUtils::getTrafficLightIds() const
-{
-  using namespace lanelet::utils::query;
-
-  std::vector<std::int64_t> ids;
-
-  for (auto && traffic_light : autowareTrafficLights(laneletLayer(lanelet_map_ptr_))) {
-    for (auto && light_bulb : traffic_light->lightBulbs()) {
-      if (light_bulb.hasAttribute("traffic_light_id")) {
-        if (auto id = light_bulb.attribute("traffic_light_id").asId()) {
-          ids.emplace_back(id.value());
-        }
-      }
-    }
-  }
-
-  return ids;
-}
+std::vector<std::int64_t> HdMapUtils::getTrafficLightIds() const { return traffic_light_ids_; }
 
 std::optional<geometry_msgs::msg::Point> HdMapUtils::getTrafficLightBulbPosition(
   std::int64_t traffic_light_id, const std::string & color_name) const
 {
-  lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(lanelet_map_ptr_);
-  auto autoware_traffic_lights = lanelet::utils::query::autowareTrafficLights(all_lanelets);
-
-  auto areBulbsAssignedToTrafficLight = [traffic_light_id](auto red_yellow_green_bulbs) -> bool {
-    return red_yellow_green_bulbs.hasAttribute("traffic_light_id") and
-           red_yellow_green_bulbs.attribute("traffic_light_id").asId() and
-           red_yellow_green_bulbs.attribute("traffic_light_id").asId().value() == traffic_light_id;
-  };
-
-  auto isBulbOfExpectedColor = [color_name](auto bulb) -> bool {
-    return bulb.hasAttribute("color") and !bulb.hasAttribute("arrow") and
-           bulb.attribute("color").value().compare(color_name) == 0;
-  };
-
-  for (const auto & light : autoware_traffic_lights) {
-    for (auto three_light_bulbs : light->lightBulbs()) {
-      if (areBulbsAssignedToTrafficLight(three_light_bulbs)) {
-        for (auto bulb : static_cast<lanelet::ConstLineString3d>(three_light_bulbs)) {
-          if (isBulbOfExpectedColor(bulb)) {
-            geometry_msgs::msg::Point point;
-            point.x = bulb.x();
-            point.y = bulb.y();
-            point.z = bulb.z();
-            return point;
-          }
-        }
-      }
+  if (const auto bulbs = traffic_light_bulb_positions_.find(traffic_light_id);
+      bulbs != traffic_light_bulb_positions_.end()) {
+    if (const auto bulb = bulbs->second.find(color_name); bulb != bulbs->second.end()) {
+      return bulb->second;
     }
   }
   return std::nullopt;
@@ -1626,46 +1940,16 @@ std::vector<std::int64_t> HdMapUtils::getRightOfWayLaneletIds(std::int64_t lanel
   return ret;
 }
 
-std::vector<std::shared_ptr<const lanelet::TrafficSign>>
-HdMapUtils::getTrafficSignRegElementsOnPath(const std::vector<std::int64_t> & lanelet_ids) const
-{
-  std::vector<std::shared_ptr<const lanelet::TrafficSign>> ret;
-  for (const auto & lanelet_id : lanelet_ids) {
-    const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
-    const auto traffic_signs = lanelet.regulatoryElementsAs<const lanelet::TrafficSign>();
-    for (const auto & traffic_sign : traffic_signs) {
-      ret.push_back(traffic_sign);
-    }
-  }
-  return ret;
-}
-
-std::vector<std::shared_ptr<const lanelet::autoware::AutowareTrafficLight>>
-HdMapUtils::getTrafficLightRegElementsOnPath(const std::vector<std::int64_t> & lanelet_ids) const
-{
-  std::vector<std::shared_ptr<const lanelet::autoware::AutowareTrafficLight>> ret;
-  for (const auto & lanelet_id : lanelet_ids) {
-    const auto lanelet = lanelet_map_ptr_->laneletLayer.get(lanelet_id);
-    const auto traffic_lights =
-      lanelet.regulatoryElementsAs<const lanelet::autoware::AutowareTrafficLight>();
-    for (const auto & traffic_light : traffic_lights) {
-      ret.push_back(traffic_light);
-    }
-  }
-  return ret;
-}
-
 std::vector<lanelet::ConstLineString3d> HdMapUtils::getStopLinesOnPath(
   const std::vector<std::int64_t> & lanelet_ids) const
 {
   std::vector<lanelet::ConstLineString3d> ret;
-  const auto traffic_signs = getTrafficSignRegElementsOnPath(lanelet_ids);
-  for (const auto & traffic_sign : traffic_signs) {
-    if (traffic_sign->type() != "stop_sign") {
-      continue;
-    }
-    for (const auto & stop_line : traffic_sign->refLines()) {
-      ret.emplace_back(stop_line);
+  for (const auto & lanelet_id : lanelet_ids) {
+    if (const auto stop_lines = stop_lines_on_lanelet_.find(lanelet_id);
+        stop_lines != stop_lines_on_lanelet_.end()) {
+      ret.insert(ret.end(), stop_lines->second.begin(), stop_lines->second.end());
+    } else {
+      THROW_SEMANTIC_ERROR("No such lanelet ", lanelet_id, ".");
     }
   }
   return ret;
@@ -1684,23 +1968,11 @@ std::vector<std::int64_t> HdMapUtils::getStopLineIdsOnPath(
 std::vector<lanelet::AutowareTrafficLightConstPtr> HdMapUtils::getTrafficLights(
   const std::int64_t traffic_light_id) const
 {
-  std::vector<lanelet::AutowareTrafficLightConstPtr> ret;
-  lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(lanelet_map_ptr_);
-  auto autoware_traffic_lights = lanelet::utils::query::autowareTrafficLights(all_lanelets);
-  for (const auto & light : autoware_traffic_lights) {
-    for (auto light_string : light->lightBulbs()) {
-      if (light_string.hasAttribute("traffic_light_id")) {
-        auto id = light_string.attribute("traffic_light_id").asId();
-        if (id == traffic_light_id) {
-          ret.emplace_back(light);
-        }
-      }
-    }
-  }
-  if (ret.empty()) {
-    THROW_SEMANTIC_ERROR("traffic_light_id does not match. ID : ", traffic_light_id);
+  if (const auto traffic_lights = traffic_lights_.find(traffic_light_id);
+      traffic_lights != traffic_lights_.end()) {
+    return traffic_lights->second;
   }
-  return ret;
+  THROW_SEMANTIC_ERROR("traffic_light_id does not match. ID : ", traffic_light_id);
 }
 
 std::vector<std::int64_t> HdMapUtils::getTrafficLightStopLineIds(
@@ -1719,23 +1991,11 @@ std::vector<std::int64_t> HdMapUtils::getTrafficLightStopLineIds(
 std::vector<std::vector<geometry_msgs::msg::Point>> HdMapUtils::getTrafficLightStopLinesPoints(
   std::int64_t traffic_light_id) const
 {
-  std::vector<std::vector<geometry_msgs::msg::Point>> ret;
-  const auto traffic_lights = getTrafficLights(traffic_light_id);
-  for (const auto & traffic_light : traffic_lights) {
-    ret.emplace_back(std::vector<geometry_msgs::msg::Point>{});
-    const auto stop_line = traffic_light->stopLine();
-    if (stop_line) {
-      auto & current_stop_line = ret.back();
-      for (const auto & point : stop_line.value()) {
-        geometry_msgs::msg::Point p;
-        p.x = point.x();
-        p.y = point.y();
-        p.z = point.z();
-        current_stop_line.emplace_back(p);
-      }
-    }
+  if (const auto stop_lines_points = traffic_light_stop_lines_points_.find(traffic_light_id);
+      stop_lines_points != traffic_light_stop_lines_points_.end()) {
+    return stop_lines_points->second;
   }
-  return ret;
+  THROW_SEMANTIC_ERROR("traffic_light_id does not match. ID : ", traffic_light_id);
 }
 
 std::vector<geometry_msgs::msg::Point> HdMapUtils::getStopLinePolygon(std::int64_t lanelet_id) const
@@ -1756,15 +2016,12 @@ std::vector<std::int64_t> HdMapUtils::getTrafficLightIdsOnPath(
   const std::vector<std::int64_t> & route_lanelets) const
 {
   std::vector<std::int64_t> ret;
-  auto traffic_lights = getTrafficLightRegElementsOnPath(route_lanelets);
-  for (const auto & traffic_light : traffic_lights) {
-    for (auto light_string : traffic_light->lightBulbs()) {
-      if (light_string.hasAttribute("traffic_light_id")) {
-        auto id = light_string.attribute("traffic_light_id").asId();
-        if (id) {
-          ret.emplace_back(id.value());
-        }
-      }
+  for (const auto & lanelet_id : route_lanelets) {
+    if (const auto traffic_light_ids = traffic_light_ids_on_lanelet_.find(lanelet_id);
+        traffic_light_ids != traffic_light_ids_on_lanelet_.end()) {
+      ret += traffic_light_ids->second;
+    } else {
+      THROW_SEMANTIC_ERROR("No such lanelet ", lanelet_id, ".");
     }
   }
   return ret;
@@ -1861,15 +2118,7 @@ std::optional<double> HdMapUtils::getDistanceToStopLine(
   math::geometry::CatmullRomSpline spline(waypoints);
   const auto stop_lines = getStopLinesOnPath({route_lanelets});
   for (const auto & stop_line : stop_lines) {
-    std::vector<geometry_msgs::msg::Point> stop_line_points;
-    for (const auto & point : stop_line) {
-      geometry_msgs::msg::Point p;
-      p.x = point.x();
-      p.y = point.y();
-      p.z = point.z();
-      stop_line_points.emplace_back(p);
-    }
-    const auto collision_point = spline.getCollisionPointIn2D(stop_line_points);
+    const auto collision_point = spline.getCollisionPointIn2D(toPolygon(stop_line));
     if (collision_point) {
       collision_points.insert(collision_point.value());
     }
@@ -1890,15 +2139,7 @@ std::optional<double> HdMapUtils::getDistanceToStopLine(
   std::set<double> collision_points;
   const auto stop_lines = getStopLinesOnPath({route_lanelets});
   for (const auto & stop_line : stop_lines) {
-    std::vector<geometry_msgs::msg::Point> stop_line_points;
-    for (const auto & point : stop_line) {
-      geometry_msgs::msg::Point p;
-      p.x = point.x();
-      p.y = point.y();
-      p.z = point.z();
-      stop_line_points.emplace_back(p);
-    }
-    const auto collision_point = spline.getCollisionPointIn2D(stop_line_points);
+    const auto collision_point = spline.getCollisionPointIn2D(toPolygon(stop_line));
     if (collision_point) {
       collision_points.insert(collision_point.value());
     }
@@ -2055,18 +2296,11 @@ auto HdMapUtils::getTrafficLightRegulatoryElementIDsFromTrafficLight(
   const LaneletId traffic_light_way_id) const -> std::vector<LaneletId>
 {
   assert(isTrafficLight(traffic_light_way_id));
-  std::vector<LaneletId> traffic_light_regulatory_element_ids;
-  for (const auto & regulatory_element : lanelet_map_ptr_->regulatoryElementLayer) {
-    if (regulatory_element->attribute(lanelet::AttributeName::Subtype).value() == "traffic_light") {
-      for (const auto & ref_member :
-           regulatory_element->getParameters<lanelet::ConstLineString3d>("refers")) {
-        if (ref_member.id() == traffic_light_way_id) {
-          traffic_light_regulatory_element_ids.push_back(regulatory_element->id());
-        }
-      }
-    }
+  if (const auto ids = traffic_light_regulatory_element_ids_.find(traffic_light_way_id);
+      ids != traffic_light_regulatory_element_ids_.end()) {
+    return ids->second;
   }
-  return traffic_light_regulatory_element_ids;
+  return {};
 }
 
 std::vector<geometry_msgs::msg::Point> HdMapUtils::toPolygon(
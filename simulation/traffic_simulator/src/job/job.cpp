@@ -13,16 +13,17 @@
 // limitations under the License.
 
 #include <traffic_simulator/job/job.hpp>
+#include <utility>
 
 namespace traffic_simulator
 {
 namespace job
 {
 Job::Job(
-  const std::function<bool(const double)> & func_on_update,
-  const std::function<void()> & func_on_cleanup, job::Type type, bool exclusive, job::Event event)
-: func_on_update_(func_on_update),
-  func_on_cleanup_(func_on_cleanup),
+  InplaceFunction<bool(double)> func_on_update, InplaceFunction<void()> func_on_cleanup,
+  job::Type type, bool exclusive, job::Event event)
+: func_on_update_(std::move(func_on_update)),
+  func_on_cleanup_(std::move(func_on_cleanup)),
   job_duration_(0.0),
   type(type),
   exclusive(exclusive),
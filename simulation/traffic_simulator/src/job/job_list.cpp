@@ -12,32 +12,46 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <rclcpp/rclcpp.hpp>
+#include <algorithm>
 #include <traffic_simulator/job/job_list.hpp>
+#include <utility>
 
 namespace traffic_simulator
 {
 namespace job
 {
 void JobList::append(
-  const std::function<bool(double)> & func_on_update, const std::function<void()> & func_on_cleanup,
+  InplaceFunction<bool(double)> func_on_update, InplaceFunction<void()> func_on_cleanup,
   job::Type type, bool exclusive, const job::Event event)
 {
-  for (auto & job : list_) {
-    if (job.type == type && job.exclusive == exclusive && job.getStatus() == job::Status::ACTIVE) {
-      job.inactivate();
-    }
+  auto & job = list_[slot(type, exclusive)];
+  if (job && job->getStatus() == job::Status::ACTIVE) {
+    job->inactivate();
   }
-  list_.emplace_back(Job(func_on_update, func_on_cleanup, type, exclusive, event));
+  job.emplace(std::move(func_on_update), std::move(func_on_cleanup), type, exclusive, event);
 }
 
 void JobList::update(const double step_time, const job::Event event)
 {
   for (auto & job : list_) {
-    if (job.event == event) {
-      job.onUpdate(step_time);
+    if (job && job->event == event) {
+      job->onUpdate(step_time);
+      if (job->getStatus() == job::Status::INACTIVE) {
+        job.reset();
+      }
     }
   }
 }
+
+auto JobList::size() const -> std::size_t
+{
+  return static_cast<std::size_t>(
+    std::count_if(list_.begin(), list_.end(), [](const auto & job) { return job.has_value(); }));
+}
+
+auto JobList::slot(job::Type type, bool exclusive) -> std::size_t
+{
+  return static_cast<std::size_t>(type) * 2 + (exclusive ? 1 : 0);
+}
 }  // namespace job
 }  // namespace traffic_simulator
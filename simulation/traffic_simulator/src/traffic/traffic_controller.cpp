@@ -59,15 +59,26 @@ void TrafficController::autoSink()
       lanelet_pose.lanelet_id = lanelet_id;
       lanelet_pose.s = hdmap_utils_->getLaneletLength(lanelet_id);
       const auto pose = hdmap_utils_->toMapPose(lanelet_pose);
-      addModule<traffic_simulator::traffic::TrafficSink>(
+      auto_sinks_.insert(std::make_shared<traffic_simulator::traffic::TrafficSink>(
         1, pose.pose.position, get_entity_names_function, get_entity_pose_function,
-        despawn_function);
+        despawn_function));
     }
   }
 }
 
 void TrafficController::execute()
 {
+  if (not auto_sinks_.empty()) {
+    std::vector<std::string> despawned_entities;
+    for (const auto & name : get_entity_names_function()) {
+      if (auto_sinks_.contains(get_entity_pose_function(name))) {
+        despawned_entities.push_back(name);
+      }
+    }
+    for (const auto & name : despawned_entities) {
+      despawn_function(name);
+    }
+  }
   for (const auto & module : modules_) {
     module->execute();
   }
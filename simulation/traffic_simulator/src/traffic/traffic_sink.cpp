@@ -53,11 +53,15 @@ void TrafficSink::execute()
 {
   const auto names = get_entity_names_function();
   for (const auto & name : names) {
-    const auto pose = get_entity_pose_function(name);
-    if (math::geometry::getDistance(position, pose) <= radius) {
+    if (isInside(get_entity_pose_function(name))) {
       despawn_function(name);
     }
   }
 }
+
+auto TrafficSink::isInside(const geometry_msgs::msg::Pose & pose) const -> bool
+{
+  return math::geometry::getDistance(position, pose) <= radius;
+}
 }  // namespace traffic
 }  // namespace traffic_simulator
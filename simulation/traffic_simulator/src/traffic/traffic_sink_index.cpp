@@ -0,0 +1,63 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <traffic_simulator/traffic/traffic_sink_index.hpp>
+
+namespace traffic_simulator
+{
+namespace traffic
+{
+auto TrafficSinkIndex::insert(const std::shared_ptr<TrafficSink> & sink) -> void
+{
+  const auto index = sinks_.size();
+  sinks_.push_back(sink);
+  const auto [min_x, min_y] =
+    toGridCell(sink->position.x - sink->radius, sink->position.y - sink->radius);
+  const auto [max_x, max_y] =
+    toGridCell(sink->position.x + sink->radius, sink->position.y + sink->radius);
+  for (auto cell_x = min_x; cell_x <= max_x; ++cell_x) {
+    for (auto cell_y = min_y; cell_y <= max_y; ++cell_y) {
+      grid_[toGridKey(cell_x, cell_y)].push_back(index);
+    }
+  }
+}
+
+auto TrafficSinkIndex::contains(const geometry_msgs::msg::Pose & pose) const -> bool
+{
+  const auto [cell_x, cell_y] = toGridCell(pose.position.x, pose.position.y);
+  if (const auto cell = grid_.find(toGridKey(cell_x, cell_y)); cell != grid_.end()) {
+    for (const auto index : cell->second) {
+      if (sinks_[index]->isInside(pose)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+auto TrafficSinkIndex::toGridCell(double x, double y) -> std::pair<std::int64_t, std::int64_t>
+{
+  return {
+    static_cast<std::int64_t>(std::floor(x / grid_cell_size)),
+    static_cast<std::int64_t>(std::floor(y / grid_cell_size))};
+}
+
+auto TrafficSinkIndex::toGridKey(std::int64_t cell_x, std::int64_t cell_y) -> std::int64_t
+{
+  return static_cast<std::int64_t>(
+    (static_cast<std::uint64_t>(cell_x) << 32) ^ (static_cast<std::uint64_t>(cell_y) & 0xFFFFFFFF));
+}
+}  // namespace traffic
+}  // namespace traffic_simulator
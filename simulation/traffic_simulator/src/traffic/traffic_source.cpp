@@ -0,0 +1,126 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <geometry/distance.hpp>
+#include <scenario_simulator_exception/exception.hpp>
+#include <string>
+#include <traffic_simulator/traffic/traffic_source.hpp>
+#include <unordered_set>
+#include <vector>
+
+namespace traffic_simulator
+{
+namespace traffic
+{
+TrafficSource::TrafficSource(
+  const std::string & name, const std::vector<CanonicalizedLaneletPose> & spawn_poses,
+  const Configuration & configuration,
+  const std::function<std::vector<std::string>(void)> & get_entity_names_function,
+  const std::function<geometry_msgs::msg::Pose(const std::string &)> & get_entity_pose_function,
+  const std::function<void(const std::string &, const CanonicalizedLaneletPose &)> & spawn_function,
+  const std::function<double(void)> & get_current_time_function)
+: TrafficModuleBase(),
+  name(name),
+  configuration(configuration),
+  get_entity_names_function(get_entity_names_function),
+  get_entity_pose_function(get_entity_pose_function),
+  spawn_function(spawn_function),
+  get_current_time_function(get_current_time_function),
+  spawn_poses_(spawn_poses),
+  region_center_([&]() {
+    geometry_msgs::msg::Point center;
+    for (const auto & spawn_pose : spawn_poses) {
+      const auto position = static_cast<geometry_msgs::msg::Pose>(spawn_pose).position;
+      center.x += position.x / spawn_poses.size();
+      center.y += position.y / spawn_poses.size();
+      center.z += position.z / spawn_poses.size();
+    }
+    return center;
+  }()),
+  engine_(configuration.seed)
+{
+  if (spawn_poses_.empty()) {
+    THROW_SEMANTIC_ERROR("Traffic source ", name, " has no spawn pose.");
+  }
+  if (not(configuration.rate > 0.0)) {
+    THROW_SEMANTIC_ERROR(
+      "Traffic source ", name, " has non-positive rate (which is ", configuration.rate, ").");
+  }
+}
+
+void TrafficSource::execute()
+{
+  const auto current_time = get_current_time_function();
+  if (std::isnan(current_time)) {
+    return;
+  }
+  if (std::isnan(next_arrival_time_)) {
+    next_arrival_time_ = current_time + makeInterval();
+  }
+  if (current_time < next_arrival_time_) {
+    return;
+  }
+  const auto entity_names = get_entity_names_function();
+  std::unordered_set<std::string> used_names(entity_names.begin(), entity_names.end());
+  std::vector<geometry_msgs::msg::Point> entity_positions;
+  for (const auto & entity_name : entity_names) {
+    entity_positions.push_back(get_entity_pose_function(entity_name).position);
+  }
+  std::uniform_int_distribution<std::size_t> spawn_pose_index(0, spawn_poses_.size() - 1);
+  for (; next_arrival_time_ <= current_time; next_arrival_time_ += makeInterval()) {
+    const auto & spawn_pose = spawn_poses_[spawn_pose_index(engine_)];
+    const auto spawn_position = static_cast<geometry_msgs::msg::Pose>(spawn_pose).position;
+    if (isSpawnable(spawn_position, entity_positions)) {
+      auto entity_name = name + "_" + std::to_string(next_entity_number_++);
+      while (used_names.count(entity_name)) {
+        entity_name = name + "_" + std::to_string(next_entity_number_++);
+      }
+      spawn_function(entity_name, spawn_pose);
+      used_names.insert(entity_name);
+      entity_positions.push_back(spawn_position);
+      ++number_of_spawned_entities_;
+    }
+  }
+}
+
+auto TrafficSource::makeInterval() -> double
+{
+  switch (configuration.arrival) {
+    case Arrival::POISSON:
+      return std::exponential_distribution<double>(configuration.rate)(engine_);
+    default:
+      return 1.0 / configuration.rate;
+  }
+}
+
+auto TrafficSource::isSpawnable(
+  const geometry_msgs::msg::Point & spawn_position,
+  const std::vector<geometry_msgs::msg::Point> & entity_positions) const -> bool
+{
+  std::size_t number_of_entities_in_region = 0;
+  for (const auto & entity_position : entity_positions) {
+    if (math::geometry::getDistance(spawn_position, entity_position) < configuration.clearance) {
+      return false;
+    }
+    if (
+      math::geometry::getDistance(region_center_, entity_position) <=
+      configuration.region_radius) {
+      ++number_of_entities_in_region;
+    }
+  }
+  return number_of_entities_in_region < configuration.maximum_number_of_entities_in_region;
+}
+}  // namespace traffic
+}  // namespace traffic_simulator
@@ -0,0 +1,123 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <scenario_simulator_exception/exception.hpp>
+#include <traffic_simulator/behavior/follow_trajectory.hpp>
+#include <utility>
+#include <vector>
+
+constexpr auto unspecified = std::numeric_limits<double>::quiet_NaN();
+
+auto makePolylineTrajectory(
+  const std::vector<std::pair<double, double>> & positions, const std::vector<double> & times,
+  bool closed) -> std::shared_ptr<traffic_simulator_msgs::msg::PolylineTrajectory>
+{
+  auto polyline_trajectory = std::make_shared<traffic_simulator_msgs::msg::PolylineTrajectory>();
+  polyline_trajectory->dynamic_constraints_ignorable = true;
+  polyline_trajectory->base_time = unspecified;
+  polyline_trajectory->closed = closed;
+  for (std::size_t i = 0; i < positions.size(); ++i) {
+    traffic_simulator_msgs::msg::Vertex vertex;
+    vertex.position.position.x = positions[i].first;
+    vertex.position.position.y = positions[i].second;
+    vertex.time = times[i];
+    polyline_trajectory->shape.vertices.push_back(vertex);
+  }
+  return polyline_trajectory;
+}
+
+TEST(FollowTrajectory, Cursor)
+{
+  const auto polyline_trajectory = makePolylineTrajectory(
+    {{0, 0}, {3, 4}, {3, 10}, {4, 10}}, {unspecified, unspecified, 3.0, unspecified}, false);
+  traffic_simulator::follow_trajectory::Cursor cursor(polyline_trajectory);
+  EXPECT_EQ(cursor.size(), 4U);
+  EXPECT_EQ(cursor.findFirstWaypointWithArrivalTime(), 2U);
+  EXPECT_DOUBLE_EQ(cursor.getLengthTo(2), 11.0);
+  cursor.pop();
+  EXPECT_EQ(cursor.size(), 3U);
+  EXPECT_DOUBLE_EQ(cursor.front().position.position.x, 3.0);
+  EXPECT_EQ(cursor.findFirstWaypointWithArrivalTime(), 1U);
+  EXPECT_DOUBLE_EQ(cursor.getLengthTo(1), 6.0);
+  EXPECT_DOUBLE_EQ(cursor.getLengthTo(2), 7.0);
+  cursor.pop();
+  cursor.pop();
+  EXPECT_FALSE(cursor.findFirstWaypointWithArrivalTime());
+  cursor.pop();
+  EXPECT_TRUE(cursor.empty());
+  EXPECT_FALSE(cursor.findFirstWaypointWithArrivalTime());
+  /// @note The trajectory itself is never modified by passing waypoints.
+  EXPECT_EQ(polyline_trajectory->shape.vertices.size(), 4U);
+}
+
+TEST(FollowTrajectory, CursorOnClosedTrajectory)
+{
+  traffic_simulator::follow_trajectory::Cursor cursor(
+    makePolylineTrajectory({{0, 0}, {3, 4}, {3, 10}}, {5.0, unspecified, unspecified}, true));
+  cursor.pop();
+  EXPECT_EQ(cursor.size(), 3U);
+  EXPECT_DOUBLE_EQ(cursor.front().position.position.x, 3.0);
+  EXPECT_DOUBLE_EQ(cursor[2].position.position.x, 0.0);
+  EXPECT_EQ(cursor.findFirstWaypointWithArrivalTime(), 2U);
+  EXPECT_DOUBLE_EQ(cursor.getLengthTo(2), 6.0 + std::hypot(3.0, 10.0));
+  cursor.pop();
+  cursor.pop();
+  EXPECT_DOUBLE_EQ(cursor.front().position.position.x, 0.0);
+  EXPECT_EQ(cursor.findFirstWaypointWithArrivalTime(), 0U);
+}
+
+TEST(FollowTrajectory, FollowLongTrajectory)
+{
+  std::vector<std::pair<double, double>> positions;
+  std::vector<double> times;
+  for (int i = 1; i <= 1000; ++i) {
+    positions.emplace_back(i, 0.0);
+    times.push_back(i % 100 == 0 ? i / 10.0 : unspecified);
+  }
+  traffic_simulator::follow_trajectory::Cursor cursor(
+    makePolylineTrajectory(positions, times, false));
+  traffic_simulator_msgs::msg::EntityStatus entity_status;
+  entity_status.action_status.twist.linear.x = 10.0;
+  std::size_t frames = 0;
+  while (const auto updated_status = traffic_simulator::follow_trajectory::makeUpdatedStatus(
+           entity_status, cursor, traffic_simulator_msgs::msg::BehaviorParameter(), 0.05)) {
+    entity_status = updated_status.value();
+    ASSERT_LT(++frames, 2100U);
+  }
+  EXPECT_TRUE(cursor.empty());
+  EXPECT_NEAR(entity_status.pose.position.x, 1000.0, 1.0);
+  EXPECT_NEAR(entity_status.time, 100.0, 0.1);
+}
+
+TEST(FollowTrajectory, PassAllWaypointsOfClosedTrajectory)
+{
+  traffic_simulator::follow_trajectory::Cursor cursor(
+    makePolylineTrajectory({{0, 0}}, {unspecified}, true));
+  EXPECT_THROW(
+    traffic_simulator::follow_trajectory::makeUpdatedStatus(
+      traffic_simulator_msgs::msg::EntityStatus(), cursor,
+      traffic_simulator_msgs::msg::BehaviorParameter(), 0.05),
+    common::SimulationError);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,164 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <traffic_simulator/behavior/intelligent_driver_model.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+
+namespace idm = traffic_simulator::intelligent_driver_model;
+
+TEST(IntelligentDriverModel, FreeRoad)
+{
+  const idm::Parameter parameter;
+  EXPECT_DOUBLE_EQ(idm::calculateAcceleration(0.0, 10.0, std::nullopt), parameter.acceleration);
+  EXPECT_DOUBLE_EQ(idm::calculateAcceleration(10.0, 10.0, std::nullopt), 0.0);
+  EXPECT_LT(idm::calculateAcceleration(12.0, 10.0, std::nullopt), 0.0);
+  EXPECT_DOUBLE_EQ(
+    idm::calculateAcceleration(5.0, 0.0, std::nullopt), -parameter.comfortable_deceleration);
+  EXPECT_DOUBLE_EQ(idm::calculateAcceleration(0.0, 0.0, std::nullopt), 0.0);
+}
+
+TEST(IntelligentDriverModel, EquilibriumGap)
+{
+  const idm::Parameter parameter;
+  const auto speed = 10.0;
+  const auto desired_speed = 15.0;
+  const auto gap = parameter.minimum_gap + speed * parameter.time_headway;
+  EXPECT_NEAR(
+    idm::calculateAcceleration(speed, desired_speed, idm::Neighbour{gap, speed}),
+    -parameter.acceleration * std::pow(speed / desired_speed, parameter.acceleration_exponent),
+    1e-12);
+  EXPECT_LT(
+    idm::calculateAcceleration(10.0, 15.0, idm::Neighbour{20.0, 0.0}),
+    -parameter.comfortable_deceleration);
+}
+
+/// @note The follower of a leader braking to a stop neither collides nor stops far behind.
+TEST(IntelligentDriverModel, FollowLeaderToStop)
+{
+  const idm::Parameter parameter;
+  const auto step_time = 0.05;
+  auto leader_position = parameter.minimum_gap + 15.0 * parameter.time_headway;
+  auto leader_speed = 15.0;
+  auto position = 0.0;
+  auto speed = 15.0;
+  auto minimum_gap = leader_position - position;
+  for (int i = 0; i < 2000; ++i) {
+    const auto acceleration = std::max(
+      idm::calculateAcceleration(
+        speed, 15.0, idm::Neighbour{leader_position - position, leader_speed}),
+      -10.0);
+    const auto updated_speed = std::max(speed + acceleration * step_time, 0.0);
+    position += (speed + updated_speed) / 2.0 * step_time;
+    speed = updated_speed;
+    const auto updated_leader_speed = std::max(leader_speed - 3.0 * step_time, 0.0);
+    leader_position += (leader_speed + updated_leader_speed) / 2.0 * step_time;
+    leader_speed = updated_leader_speed;
+    minimum_gap = std::min(minimum_gap, leader_position - position);
+  }
+  EXPECT_GT(minimum_gap, 0.0);
+  EXPECT_NEAR(leader_position - position, parameter.minimum_gap, 0.1);
+  EXPECT_NEAR(speed, 0.0, 1e-3);
+}
+
+TEST(IntelligentDriverModel, LaneChangeIncentive)
+{
+  const idm::Parameter parameter;
+  const auto blocked = idm::Neighbours{idm::Neighbour{10.0, 2.0}, std::nullopt};
+  const auto free = idm::Neighbours{};
+  /// @note Overtaking a slow leader on a free lane is beneficial, going back behind it is not.
+  EXPECT_GT(
+    idm::calculateLaneChangeIncentive(10.0, 15.0, 5.0, blocked, free).value(),
+    parameter.lane_change_threshold);
+  EXPECT_LT(idm::calculateLaneChangeIncentive(10.0, 15.0, 5.0, free, blocked).value(), 0.0);
+  EXPECT_DOUBLE_EQ(idm::calculateLaneChangeIncentive(10.0, 15.0, 5.0, free, free).value(), 0.0);
+  /// @note Cutting in right in front of a fast follower is unsafe.
+  EXPECT_FALSE(idm::calculateLaneChangeIncentive(
+    10.0, 15.0, 5.0, blocked, idm::Neighbours{std::nullopt, idm::Neighbour{2.0, 15.0}}));
+  /// @note Changing to a lane occupied beside the vehicle is impossible.
+  EXPECT_FALSE(idm::calculateLaneChangeIncentive(
+    10.0, 15.0, 5.0, blocked, idm::Neighbours{idm::Neighbour{-1.0, 10.0}, std::nullopt}));
+}
+
+TEST(IntelligentDriverModel, Politeness)
+{
+  auto parameter = idm::Parameter();
+  const auto current_lane = idm::Neighbours{idm::Neighbour{20.0, 8.0}, std::nullopt};
+  /// @note The new follower has to brake, but not harder than the safe deceleration.
+  const auto target_lane = idm::Neighbours{std::nullopt, idm::Neighbour{20.0, 12.0}};
+  parameter.politeness = 0.0;
+  const auto selfish =
+    idm::calculateLaneChangeIncentive(10.0, 15.0, 5.0, current_lane, target_lane, parameter);
+  parameter.politeness = 1.0;
+  const auto polite =
+    idm::calculateLaneChangeIncentive(10.0, 15.0, 5.0, current_lane, target_lane, parameter);
+  ASSERT_TRUE(selfish);
+  ASSERT_TRUE(polite);
+  EXPECT_LT(polite.value(), selfish.value());
+}
+
+TEST(IntelligentDriverModel, FindNeighbours)
+{
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  const auto hdmap_utils = std::make_shared<hdmap_utils::HdMapUtils>(
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm",
+    origin);
+  const auto following_lanelet_ids = hdmap_utils->getFollowingLanelets(34513);
+  ASSERT_GE(following_lanelet_ids.size(), 2U);
+  const auto lane = idm::makeLane(*hdmap_utils, following_lanelet_ids);
+  ASSERT_EQ(lane.lanelet_ids.size(), lane.offsets.size());
+
+  const auto makeEntityStatus =
+    [&](const std::string & name, std::int64_t lanelet_id, double s, double speed) {
+      traffic_simulator::EntityStatus status;
+      status.name = name;
+      status.bounding_box.dimensions.x = 2.0;
+      status.action_status.twist.linear.x = speed;
+      status.lanelet_pose = traffic_simulator::helper::constructLaneletPose(lanelet_id, s, 0.0);
+      status.lanelet_pose_valid = true;
+      status.pose = hdmap_utils->toMapPose(status.lanelet_pose).pose;
+      return traffic_simulator::CanonicalizedEntityStatus(status, hdmap_utils);
+    };
+  auto snapshot = std::make_shared<traffic_simulator::EntityStatusSnapshot>();
+  snapshot->emplace("ego", makeEntityStatus("ego", 34513, 4.0, 5.0));
+  snapshot->emplace("follower", makeEntityStatus("follower", 34513, 1.0, 6.0));
+  snapshot->emplace("leader", makeEntityStatus("leader", following_lanelet_ids[1], 3.0, 7.0));
+  snapshot->emplace(
+    "far_leader", makeEntityStatus("far_leader", following_lanelet_ids[1], 8.0, 8.0));
+
+  const auto neighbours = idm::findNeighbours(
+    traffic_simulator::OtherEntityStatusView(snapshot, "ego"), lane, 4.0,
+    snapshot->at("ego").getBoundingBox());
+  ASSERT_TRUE(neighbours.leader);
+  EXPECT_NEAR(
+    neighbours.leader->gap, hdmap_utils->getLaneletLength(34513) - 4.0 + 3.0 - 2.0, 1e-6);
+  EXPECT_DOUBLE_EQ(neighbours.leader->speed, 7.0);
+  ASSERT_TRUE(neighbours.follower);
+  EXPECT_NEAR(neighbours.follower->gap, 1.0, 1e-6);
+  EXPECT_DOUBLE_EQ(neighbours.follower->speed, 6.0);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,173 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <scenario_simulator_exception/exception.hpp>
+#include <traffic_simulator/behavior/longitudinal_speed_planning.hpp>
+#include <tuple>
+
+using traffic_simulator::longitudinal_speed_planning::LongitudinalSpeedPlanner;
+
+constexpr double twist_tolerance = 0.01;
+
+/// @note Result of stepping getDynamicStates until the target speed is reached.
+struct IterativeSolution
+{
+  double distance = 0;
+  /**
+   * @note True if the speed difference before or after the last step is on the edge of
+   * twist_tolerance, so that rounding may let the closed form take one step more or less.
+   */
+  bool on_boundary = false;
+};
+
+auto isOnToleranceBoundary(double target_speed, const geometry_msgs::msg::Twist & twist) -> bool
+{
+  return std::abs(std::abs(target_speed - twist.linear.x) - twist_tolerance) < 1e-9;
+}
+
+/// @note Reference implementation stepping getDynamicStates until the target speed is reached.
+auto getRunningDistanceIteratively(
+  const LongitudinalSpeedPlanner & planner, double target_speed,
+  const traffic_simulator_msgs::msg::DynamicConstraints & constraints,
+  geometry_msgs::msg::Twist twist, geometry_msgs::msg::Accel accel) -> IterativeSolution
+{
+  const auto step_time = planner.getStepTime();
+  IterativeSolution solution;
+  while (!planner.isTargetSpeedReached(target_speed, twist, twist_tolerance)) {
+    solution.on_boundary = isOnToleranceBoundary(target_speed, twist);
+    double linear_jerk;
+    std::tie(twist, accel, linear_jerk) =
+      planner.getDynamicStates(target_speed, constraints, twist, accel);
+    solution.distance += twist.linear.x * step_time +
+                         accel.linear.x * step_time * step_time / 2.0 +
+                         linear_jerk * step_time * step_time * step_time / 6.0;
+  }
+  solution.on_boundary = solution.on_boundary or isOnToleranceBoundary(target_speed, twist);
+  return solution;
+}
+
+auto makeConstraints(double acceleration, double jerk)
+  -> traffic_simulator_msgs::msg::DynamicConstraints
+{
+  traffic_simulator_msgs::msg::DynamicConstraints constraints;
+  constraints.max_speed = 30.0;
+  constraints.max_acceleration = acceleration;
+  constraints.max_acceleration_rate = jerk;
+  constraints.max_deceleration = acceleration * 1.5;
+  constraints.max_deceleration_rate = jerk * 0.8;
+  return constraints;
+}
+
+TEST(LongitudinalSpeedPlanner, GetRunningDistanceMatchesIterativeSolution)
+{
+  for (const double step_time : {0.01, 0.05, 0.1, 0.5}) {
+    LongitudinalSpeedPlanner planner(step_time, "ego");
+    for (const double acceleration : {0.3, 2.0, 9.0}) {
+      for (const double jerk : {0.5, 3.0, 50.0}) {
+        const auto constraints = makeConstraints(acceleration, jerk);
+        for (double speed = -4.87; speed <= 30.0; speed += 1.2345678) {
+          for (const double target_speed : {0.0, 3.14159, 10.2718, 24.1234, -2.2468}) {
+            for (const double linear_acceleration : {-12.3, -3.21, 0.0, 0.713, 4.11, 15.7}) {
+              geometry_msgs::msg::Twist twist;
+              twist.linear.x = speed;
+              geometry_msgs::msg::Accel accel;
+              accel.linear.x = linear_acceleration;
+              const auto expected =
+                getRunningDistanceIteratively(planner, target_speed, constraints, twist, accel);
+              /// @note One step more or less travels about target_speed * step_time.
+              EXPECT_NEAR(
+                planner.getRunningDistance(target_speed, constraints, twist, accel, 0.0),
+                expected.distance,
+                expected.on_boundary ? (std::abs(target_speed) + twist_tolerance) * step_time
+                                     : 1e-3)
+                << "step_time: " << step_time << ", speed: " << speed
+                << ", target_speed: " << target_speed << ", acceleration: " << linear_acceleration;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST(LongitudinalSpeedPlanner, GetRunningDistanceOfStop)
+{
+  LongitudinalSpeedPlanner planner(0.05, "ego");
+  const auto constraints = makeConstraints(3.0, 1.5);
+  geometry_msgs::msg::Twist twist;
+  twist.linear.x = 10.0;
+  const auto distance =
+    planner.getRunningDistance(0.0, constraints, twist, geometry_msgs::msg::Accel(), 0.0);
+  EXPECT_NEAR(
+    distance,
+    getRunningDistanceIteratively(planner, 0.0, constraints, twist, geometry_msgs::msg::Accel())
+      .distance,
+    1e-6);
+  EXPECT_GT(distance, 10.0 * 10.0 / 2.0 / constraints.max_deceleration);
+  twist.linear.x = 0.005;
+  EXPECT_DOUBLE_EQ(
+    planner.getRunningDistance(0.0, constraints, twist, geometry_msgs::msg::Accel(), 0.0), 0.0);
+}
+
+TEST(LongitudinalSpeedPlanner, GetRunningDistanceOverMaxSpeed)
+{
+  LongitudinalSpeedPlanner planner(0.05, "ego");
+  EXPECT_THROW(
+    planner.getRunningDistance(
+      40.0, makeConstraints(3.0, 1.5), geometry_msgs::msg::Twist(), geometry_msgs::msg::Accel(),
+      0.0),
+    common::SemanticError);
+}
+
+TEST(LongitudinalSpeedPlanner, GetRunningDistanceWithoutAcceleration)
+{
+  LongitudinalSpeedPlanner planner(0.05, "ego");
+  geometry_msgs::msg::Twist twist;
+  twist.linear.x = 10.0;
+  auto constraints = makeConstraints(3.0, 1.5);
+  constraints.max_deceleration = 0.0;
+  EXPECT_THROW(
+    planner.getRunningDistance(0.0, constraints, twist, geometry_msgs::msg::Accel(), 0.0),
+    common::SimulationError);
+  constraints = makeConstraints(0.0, 1.5);
+  EXPECT_THROW(
+    planner.getRunningDistance(20.0, constraints, twist, geometry_msgs::msg::Accel(), 0.0),
+    common::SimulationError);
+  /// @note The target speed is reached without acceleration.
+  EXPECT_DOUBLE_EQ(
+    planner.getRunningDistance(10.0, constraints, twist, geometry_msgs::msg::Accel(), 0.0), 0.0);
+}
+
+TEST(LongitudinalSpeedPlanner, SetStepTime)
+{
+  LongitudinalSpeedPlanner planner(0.05, "ego");
+  const auto constraints = makeConstraints(3.0, 1.5);
+  geometry_msgs::msg::Twist twist;
+  twist.linear.x = 10.0;
+  planner.setStepTime(0.1);
+  EXPECT_DOUBLE_EQ(planner.getStepTime(), 0.1);
+  EXPECT_DOUBLE_EQ(
+    planner.getRunningDistance(0.0, constraints, twist, geometry_msgs::msg::Accel(), 0.0),
+    LongitudinalSpeedPlanner(0.1, "ego")
+      .getRunningDistance(0.0, constraints, twist, geometry_msgs::msg::Accel(), 0.0));
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
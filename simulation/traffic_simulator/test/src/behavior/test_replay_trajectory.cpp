@@ -0,0 +1,230 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <scenario_simulator_exception/exception.hpp>
+#include <string>
+#include <traffic_simulator/behavior/replay_trajectory.hpp>
+#include <vector>
+
+using traffic_simulator::replay_trajectory::Cursor;
+using traffic_simulator::replay_trajectory::Interpolation;
+using traffic_simulator::replay_trajectory::State;
+using traffic_simulator::replay_trajectory::Trajectory;
+
+/// @note States of an entity driving along a circle of radius 10m at 5m/s, recorded every 0.5s.
+auto makeCircularStates(std::size_t size) -> std::vector<State>
+{
+  constexpr double radius = 10.0, speed = 5.0;
+  std::vector<State> states;
+  for (std::size_t i = 0; i < size; ++i) {
+    State state;
+    state.time = 100.0 + 0.5 * i;
+    const auto angle = speed / radius * 0.5 * i;
+    state.pose.position.x = radius * std::sin(angle);
+    state.pose.position.y = radius * (1.0 - std::cos(angle));
+    state.pose.orientation.z = std::sin(angle / 2);
+    state.pose.orientation.w = std::cos(angle / 2);
+    state.twist.linear.x = speed;
+    state.twist.angular.z = speed / radius;
+    states.push_back(state);
+  }
+  return states;
+}
+
+auto temporaryPath(const std::string & extension) -> std::string
+{
+  return testing::TempDir() + "test_replay_trajectory" + extension;
+}
+
+TEST(ReplayTrajectory, InvalidStates)
+{
+  EXPECT_THROW(Trajectory{std::vector<State>()}, common::SemanticError);
+  auto states = makeCircularStates(3);
+  states[2].time = states[1].time;
+  EXPECT_THROW(Trajectory{states}, common::SemanticError);
+  states = makeCircularStates(3);
+  states[1].pose.position.x = std::nan("");
+  EXPECT_THROW(Trajectory{states}, common::SemanticError);
+}
+
+TEST(ReplayTrajectory, LinearInterpolation)
+{
+  const Trajectory trajectory(makeCircularStates(5));
+  EXPECT_DOUBLE_EQ(trajectory.getDuration(), 2.0);
+  std::size_t hint = 0;
+  for (std::size_t i = 0; i < 5; ++i) {
+    const auto state = trajectory.interpolate(0.5 * i, hint);
+    EXPECT_DOUBLE_EQ(state.pose.position.x, trajectory.getStates()[i].pose.position.x);
+    EXPECT_DOUBLE_EQ(state.pose.position.y, trajectory.getStates()[i].pose.position.y);
+  }
+  const auto & states = trajectory.getStates();
+  const auto state = trajectory.interpolate(0.75, hint);
+  EXPECT_DOUBLE_EQ(state.time, states[1].time + 0.25);
+  EXPECT_DOUBLE_EQ(
+    state.pose.position.x, (states[1].pose.position.x + states[2].pose.position.x) / 2);
+  EXPECT_DOUBLE_EQ(state.twist.linear.x, 5.0);
+  const auto & q = state.pose.orientation;
+  EXPECT_NEAR(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w, 1.0, 1e-12);
+  EXPECT_DOUBLE_EQ(
+    trajectory.interpolate(-1.0, hint).pose.position.x, states.front().pose.position.x);
+  EXPECT_DOUBLE_EQ(
+    trajectory.interpolate(10.0, hint).pose.position.x, states.back().pose.position.x);
+}
+
+TEST(ReplayTrajectory, HintIndependentInterpolation)
+{
+  const Trajectory trajectory(makeCircularStates(100), Interpolation::CUBIC_HERMITE);
+  std::size_t forward_hint = 0;
+  for (double time = 0.0; time < trajectory.getDuration(); time += 0.37) {
+    std::size_t hint = 0;
+    EXPECT_DOUBLE_EQ(
+      trajectory.interpolate(time, forward_hint).pose.position.x,
+      trajectory.interpolate(time, hint).pose.position.x);
+  }
+  std::size_t hint = 0;
+  for (double time = trajectory.getDuration(); 0.0 < time; time -= 1.13) {
+    std::size_t reset = 0;
+    EXPECT_DOUBLE_EQ(
+      trajectory.interpolate(time, hint).pose.position.y,
+      trajectory.interpolate(time, reset).pose.position.y);
+  }
+}
+
+TEST(ReplayTrajectory, CubicHermiteInterpolation)
+{
+  const Trajectory linear(makeCircularStates(20), Interpolation::LINEAR);
+  const Trajectory hermite(makeCircularStates(20), Interpolation::CUBIC_HERMITE);
+  std::size_t hint = 0;
+  for (const auto & recorded : hermite.getStates()) {
+    const auto state = hermite.interpolate(recorded.time - hermite.getStates().front().time, hint);
+    EXPECT_NEAR(state.pose.position.x, recorded.pose.position.x, 1e-9);
+    EXPECT_NEAR(state.pose.position.y, recorded.pose.position.y, 1e-9);
+  }
+  const auto distanceFromCircle = [](const State & state) {
+    return std::abs(std::hypot(state.pose.position.x, state.pose.position.y - 10.0) - 10.0);
+  };
+  std::size_t linear_hint = 0, hermite_hint = 0;
+  for (double time = 0.25; time < hermite.getDuration(); time += 0.5) {
+    EXPECT_LT(
+      distanceFromCircle(hermite.interpolate(time, hermite_hint)),
+      distanceFromCircle(linear.interpolate(time, linear_hint)));
+  }
+}
+
+TEST(ReplayTrajectory, SaveAndLoad)
+{
+  const Trajectory trajectory(makeCircularStates(10));
+  const auto path = temporaryPath(".bin");
+  trajectory.save(path);
+  const auto loaded = Trajectory::load(path, Interpolation::CUBIC_HERMITE);
+  EXPECT_EQ(loaded.getInterpolation(), Interpolation::CUBIC_HERMITE);
+  ASSERT_EQ(loaded.getStates().size(), trajectory.getStates().size());
+  for (std::size_t i = 0; i < loaded.getStates().size(); ++i) {
+    EXPECT_EQ(loaded.getStates()[i].time, trajectory.getStates()[i].time);
+    EXPECT_EQ(loaded.getStates()[i].pose, trajectory.getStates()[i].pose);
+    EXPECT_EQ(loaded.getStates()[i].twist, trajectory.getStates()[i].twist);
+  }
+  std::remove(path.c_str());
+  EXPECT_THROW(Trajectory::load(path), common::SemanticError);
+}
+
+/// @note The number of states in a corrupted file is rejected before memory is reserved for it.
+TEST(ReplayTrajectory, LoadCorruptedBinary)
+{
+  const auto path = temporaryPath(".bin");
+  Trajectory(makeCircularStates(10)).save(path);
+  std::string content;
+  {
+    std::ifstream file(path, std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  }
+  const auto write = [&](std::uint64_t size, std::size_t length) {
+    auto corrupted = content.substr(0, length);
+    std::memcpy(corrupted.data() + 8, &size, sizeof(size));
+    std::ofstream(path, std::ios::binary) << corrupted;
+  };
+  write(std::numeric_limits<std::uint64_t>::max(), content.size());
+  EXPECT_THROW(Trajectory::load(path), common::SemanticError);
+  write(11, content.size());
+  EXPECT_THROW(Trajectory::load(path), common::SemanticError);
+  write(10, content.size() - 1);
+  EXPECT_THROW(Trajectory::load(path), common::SemanticError);
+  write(10, content.size());
+  EXPECT_EQ(Trajectory::load(path).getStates().size(), 10U);
+  std::remove(path.c_str());
+}
+
+TEST(ReplayTrajectory, LoadCsv)
+{
+  const auto path = temporaryPath(".csv");
+  std::ofstream(path) << "time,x,y,z,qx,qy,qz,qw,vx,vy,vz,wx,wy,wz\n"
+                      << "# comment\n"
+                      << "0.0,1,2,0,0,0,0,1,1,0,0,0,0,0\n"
+                      << "\n"
+                      << "1.0,2,2,0,0,0,0,1,1,0,0,0,0,0\n";
+  const auto trajectory = Trajectory::load(path);
+  ASSERT_EQ(trajectory.getStates().size(), 2U);
+  EXPECT_DOUBLE_EQ(trajectory.getStates()[1].pose.position.x, 2.0);
+  EXPECT_DOUBLE_EQ(trajectory.getStates()[1].twist.linear.x, 1.0);
+  std::ofstream(path) << "0.0,1,2,0\n";
+  EXPECT_THROW(Trajectory::load(path), common::SemanticError);
+  /// @note Only the first line can be a header, and a partially numeric line is not one.
+  std::ofstream(path) << "0.0,1,2,0,0,0,0,1,1,0,0,0,0,0\n"
+                      << "time,x,y,z,qx,qy,qz,qw,vx,vy,vz,wx,wy,wz\n"
+                      << "1.0,2,2,0,0,0,0,1,1,0,0,0,0,0\n";
+  EXPECT_THROW(Trajectory::load(path), common::SemanticError);
+  std::ofstream(path) << "# comment\n"
+                      << "time,x,y,z,qx,qy,qz,qw,vx,vy,vz,wx,wy,wz\n"
+                      << "0.0,1,2,0,0,0,0,1,1,0,0,0,0,0\n";
+  EXPECT_THROW(Trajectory::load(path), common::SemanticError);
+  std::ofstream(path) << "0.0,1,2,0,0,0,0,1,1,0,0,0,0,0\n"
+                      << "1.0,2x,2,0,0,0,0,1,1,0,0,0,0,0\n";
+  EXPECT_THROW(Trajectory::load(path), common::SemanticError);
+  std::remove(path.c_str());
+}
+
+TEST(ReplayTrajectory, Cursor)
+{
+  const auto trajectory = std::make_shared<const Trajectory>(makeCircularStates(5));
+  Cursor cursor(trajectory);
+  traffic_simulator_msgs::msg::EntityStatus status;
+  status.time = 3.0;
+  status.lanelet_pose_valid = true;
+  std::size_t frames = 0;
+  while (const auto updated_status = cursor.makeUpdatedStatus(status, 0.125)) {
+    status = updated_status.value();
+    EXPECT_DOUBLE_EQ(status.time, 3.0 + 0.125 * ++frames);
+    EXPECT_FALSE(status.lanelet_pose_valid);
+    EXPECT_NEAR(status.action_status.twist.linear.x, 5.0, 1e-12);
+  }
+  EXPECT_EQ(frames, 17U);
+  EXPECT_DOUBLE_EQ(status.pose.position.x, trajectory->getStates().back().pose.position.x);
+  EXPECT_THROW(Cursor(nullptr), common::SemanticError);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,93 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <memory>
+#include <traffic_simulator/behavior/route_planner.hpp>
+#include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+#include <vector>
+
+auto makeHdMapUtils() -> std::shared_ptr<hdmap_utils::HdMapUtils>
+{
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  return std::make_shared<hdmap_utils::HdMapUtils>(
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm",
+    origin);
+}
+
+auto makeLaneletPose(
+  const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils, std::int64_t lanelet_id, double s)
+{
+  return traffic_simulator::CanonicalizedLaneletPose(
+    traffic_simulator::helper::constructLaneletPose(lanelet_id, s, 0.0), hdmap_utils);
+}
+
+TEST(RoutePlanner, CacheFollowingLanelets)
+{
+  const auto hdmap_utils = makeHdMapUtils();
+  traffic_simulator::RoutePlanner route_planner(hdmap_utils);
+  const auto expected = hdmap_utils->getFollowingLanelets(34513, 100, true);
+  EXPECT_EQ(route_planner.getRouteLanelets(makeLaneletPose(hdmap_utils, 34513, 1.0)), expected);
+  EXPECT_EQ(route_planner.getRouteLanelets(makeLaneletPose(hdmap_utils, 34513, 5.0)), expected);
+  EXPECT_EQ(route_planner.getCacheStatistics().hits, 1U);
+  EXPECT_EQ(route_planner.getCacheStatistics().misses, 1U);
+
+  EXPECT_EQ(
+    route_planner.getRouteLanelets(makeLaneletPose(hdmap_utils, 34513, 5.0), 200),
+    hdmap_utils->getFollowingLanelets(34513, 200, true));
+  EXPECT_EQ(
+    route_planner.getRouteLanelets(makeLaneletPose(hdmap_utils, 34684, 5.0)),
+    hdmap_utils->getFollowingLanelets(34684, 100, true));
+  EXPECT_EQ(route_planner.getCacheStatistics().hits, 1U);
+  EXPECT_EQ(route_planner.getCacheStatistics().misses, 3U);
+
+  route_planner.cancelRoute();
+  EXPECT_EQ(
+    route_planner.getRouteLanelets(makeLaneletPose(hdmap_utils, 34684, 6.0)),
+    hdmap_utils->getFollowingLanelets(34684, 100, true));
+  EXPECT_EQ(route_planner.getCacheStatistics().hits, 2U);
+}
+
+TEST(RoutePlanner, CacheFollowingLaneletsAlongRoute)
+{
+  const auto hdmap_utils = makeHdMapUtils();
+  traffic_simulator::RoutePlanner route_planner(hdmap_utils);
+  const auto following_lanelets = hdmap_utils->getFollowingLanelets(34513, 100, true);
+  ASSERT_GE(following_lanelets.size(), 3U);
+  const auto goal = following_lanelets[2];
+  route_planner.setWaypoints({makeLaneletPose(hdmap_utils, goal, 1.0)});
+
+  const auto expected =
+    hdmap_utils->getFollowingLanelets(34513, hdmap_utils->getRoute(34513, goal), 100, true);
+  EXPECT_EQ(route_planner.getRouteLanelets(makeLaneletPose(hdmap_utils, 34513, 1.0)), expected);
+  EXPECT_EQ(route_planner.getRouteLanelets(makeLaneletPose(hdmap_utils, 34513, 2.0)), expected);
+  EXPECT_EQ(route_planner.getCacheStatistics().hits, 1U);
+  EXPECT_EQ(route_planner.getCacheStatistics().misses, 1U);
+
+  route_planner.cancelRoute();
+  EXPECT_EQ(
+    route_planner.getRouteLanelets(makeLaneletPose(hdmap_utils, 34513, 3.0)), following_lanelets);
+  EXPECT_EQ(route_planner.getCacheStatistics().misses, 2U);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
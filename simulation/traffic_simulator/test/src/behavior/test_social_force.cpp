@@ -0,0 +1,156 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+#include <quaternion_operation/quaternion_operation.h>
+#include <string>
+#include <traffic_simulator/behavior/social_force.hpp>
+#include <vector>
+
+auto makePedestrianStatus(const std::string & name, double x, double y, double yaw, double speed)
+  -> traffic_simulator::EntityStatus
+{
+  traffic_simulator::EntityStatus status;
+  status.name = name;
+  status.pose.position.x = x;
+  status.pose.position.y = y;
+  geometry_msgs::msg::Vector3 rpy;
+  rpy.z = yaw;
+  status.pose.orientation = quaternion_operation::convertEulerAngleToQuaternion(rpy);
+  status.bounding_box.dimensions.x = 0.5;
+  status.bounding_box.dimensions.y = 0.5;
+  status.bounding_box.dimensions.z = 1.8;
+  status.action_status.twist.linear.x = speed;
+  status.lanelet_pose_valid = false;
+  return status;
+}
+
+/// @note Updates all pedestrians from the same snapshot, as EntityManager does in one frame.
+auto step(const std::vector<traffic_simulator::EntityStatus> & statuses, double step_time)
+  -> std::vector<traffic_simulator::EntityStatus>
+{
+  auto snapshot = std::make_shared<traffic_simulator::EntityStatusSnapshot>();
+  for (const auto & status : statuses) {
+    snapshot->emplace(status.name, traffic_simulator::CanonicalizedEntityStatus(status, nullptr));
+  }
+  std::vector<traffic_simulator::EntityStatus> updated_statuses;
+  for (const auto & status : statuses) {
+    updated_statuses.push_back(traffic_simulator::social_force::makeUpdatedStatus(
+      snapshot->at(status.name), 1.2,
+      traffic_simulator::OtherEntityStatusView(snapshot, status.name),
+      traffic_simulator_msgs::msg::BehaviorParameter(), step_time));
+  }
+  return updated_statuses;
+}
+
+auto getDistance(
+  const traffic_simulator::EntityStatus & status0, const traffic_simulator::EntityStatus & status1)
+{
+  return std::hypot(
+    status0.pose.position.x - status1.pose.position.x,
+    status0.pose.position.y - status1.pose.position.y);
+}
+
+TEST(SocialForce, RelaxToDesiredVelocity)
+{
+  auto status = makePedestrianStatus("pedestrian", 0.0, 0.0, 0.0, 0.2);
+  status.action_status.twist.linear.y = 0.5;
+  const auto snapshot = std::make_shared<traffic_simulator::EntityStatusSnapshot>();
+  snapshot->emplace("pedestrian", traffic_simulator::CanonicalizedEntityStatus(status, nullptr));
+  const traffic_simulator::social_force::Parameter parameter;
+  const auto acceleration = traffic_simulator::social_force::calculateAcceleration(
+    snapshot->at("pedestrian"), 1.2,
+    traffic_simulator::OtherEntityStatusView(snapshot, "pedestrian"), parameter);
+  EXPECT_DOUBLE_EQ(acceleration.x, (1.2 - 0.2) / parameter.relaxation_time);
+  EXPECT_DOUBLE_EQ(acceleration.y, -0.5 / parameter.relaxation_time);
+}
+
+TEST(SocialForce, RepelledByEntityAhead)
+{
+  const auto snapshot = std::make_shared<traffic_simulator::EntityStatusSnapshot>();
+  snapshot->emplace(
+    "pedestrian", traffic_simulator::CanonicalizedEntityStatus(
+                    makePedestrianStatus("pedestrian", 0.0, 0.0, 0.0, 1.2), nullptr));
+  snapshot->emplace(
+    "other", traffic_simulator::CanonicalizedEntityStatus(
+               makePedestrianStatus("other", 1.0, 0.0, M_PI, 1.2), nullptr));
+  const auto acceleration = traffic_simulator::social_force::calculateAcceleration(
+    snapshot->at("pedestrian"), 1.2,
+    traffic_simulator::OtherEntityStatusView(snapshot, "pedestrian"));
+  EXPECT_LT(acceleration.x, 0.0);
+  /// @note The pedestrian sidesteps to its right.
+  EXPECT_LT(acceleration.y, 0.0);
+}
+
+TEST(SocialForce, PassHeadOn)
+{
+  std::vector<traffic_simulator::EntityStatus> statuses = {
+    makePedestrianStatus("pedestrian0", 0.0, 0.0, 0.0, 1.2),
+    makePedestrianStatus("pedestrian1", 10.0, 0.0, M_PI, 1.2)};
+  double minimum_distance = getDistance(statuses[0], statuses[1]);
+  for (int i = 0; i < 200; ++i) {
+    statuses = step(statuses, 0.05);
+    minimum_distance = std::min(minimum_distance, getDistance(statuses[0], statuses[1]));
+  }
+  EXPECT_GT(minimum_distance, 0.5);
+  EXPECT_GT(statuses[0].pose.position.x, statuses[1].pose.position.x);
+}
+
+TEST(SocialForce, AvoidVehicle)
+{
+  auto vehicle = makePedestrianStatus("vehicle", 5.0, 0.0, M_PI_2, 0.0);
+  vehicle.bounding_box.dimensions.x = 4.0;
+  vehicle.bounding_box.dimensions.y = 2.0;
+  std::vector<traffic_simulator::EntityStatus> statuses = {
+    makePedestrianStatus("pedestrian", 0.0, 0.0, 0.0, 1.2), vehicle};
+  for (int i = 0; i < 200; ++i) {
+    const auto updated_statuses = step(statuses, 0.05);
+    statuses[0] = updated_statuses[0];
+    /// @note The pedestrian never enters the bounding box of the vehicle.
+    EXPECT_FALSE(
+      std::abs(statuses[0].pose.position.x - 5.0) < 1.0 and
+      std::abs(statuses[0].pose.position.y) < 2.0);
+  }
+}
+
+TEST(SocialForce, Deterministic)
+{
+  const auto simulate = []() {
+    std::vector<traffic_simulator::EntityStatus> statuses;
+    for (int i = 0; i < 50; ++i) {
+      statuses.push_back(makePedestrianStatus(
+        "pedestrian" + std::to_string(i), (i % 10) * 1.5, (i / 10) * 1.5, (i % 2) * M_PI, 1.0));
+    }
+    for (int i = 0; i < 20; ++i) {
+      statuses = step(statuses, 0.05);
+    }
+    return statuses;
+  };
+  const auto statuses0 = simulate();
+  const auto statuses1 = simulate();
+  ASSERT_EQ(statuses0.size(), statuses1.size());
+  for (std::size_t i = 0; i < statuses0.size(); ++i) {
+    EXPECT_EQ(statuses0[i].pose.position.x, statuses1[i].pose.position.x);
+    EXPECT_EQ(statuses0[i].pose.position.y, statuses1[i].pose.position.y);
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
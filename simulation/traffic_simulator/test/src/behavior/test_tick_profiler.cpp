@@ -0,0 +1,89 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <string>
+#include <thread>
+#include <traffic_simulator/behavior/tick_profiler.hpp>
+#include <vector>
+
+using traffic_simulator::behavior::TickProfiler;
+
+TEST(TickProfiler, Enable)
+{
+  auto & profiler = TickProfiler::get();
+  EXPECT_FALSE(profiler.isEnabled());
+  profiler.enable();
+  EXPECT_TRUE(profiler.isEnabled());
+  profiler.enable(false);
+  EXPECT_FALSE(profiler.isEnabled());
+  EXPECT_EQ(&profiler, &TickProfiler::get());
+}
+
+TEST(TickProfiler, Record)
+{
+  auto & profiler = TickProfiler::get();
+  profiler.reset();
+  auto & statistics = profiler.getStatistics("FollowLane");
+  EXPECT_EQ(&statistics, &profiler.getStatistics("FollowLane"));
+  profiler.getStatistics("Yield");
+  EXPECT_EQ(profiler.toJson(), "{}");
+
+  statistics.record(std::chrono::nanoseconds(0));
+  statistics.record(std::chrono::nanoseconds(1000));
+  statistics.record(std::chrono::nanoseconds(1500));
+  statistics.record(std::chrono::hours(1000));
+  EXPECT_EQ(statistics.count(), 4U);
+  EXPECT_EQ(
+    profiler.toJson(),
+    "{\"FollowLane\":{\"count\":4,\"total_ns\":3600000000002500,\"mean_ns\":900000000000625,"
+    "\"min_ns\":0,\"max_ns\":3600000000000000,\"histogram\":["
+    "{\"lower_ns\":0,\"upper_ns\":2,\"count\":1},"
+    "{\"lower_ns\":512,\"upper_ns\":1024,\"count\":1},"
+    "{\"lower_ns\":1024,\"upper_ns\":2048,\"count\":1},"
+    "{\"lower_ns\":549755813888,\"upper_ns\":null,\"count\":1}]}}");
+
+  profiler.reset();
+  EXPECT_EQ(statistics.count(), 0U);
+  EXPECT_EQ(profiler.toJson(), "{}");
+}
+
+TEST(TickProfiler, RecordConcurrently)
+{
+  auto & profiler = TickProfiler::get();
+  profiler.reset();
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&]() {
+      auto & statistics = profiler.getStatistics("StopAtCrossingEntity");
+      for (int j = 1; j <= 1000; ++j) {
+        statistics.record(std::chrono::nanoseconds(j));
+      }
+    });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  const auto json = profiler.toJson();
+  EXPECT_NE(json.find("\"count\":4000,\"total_ns\":2002000,"), std::string::npos) << json;
+  EXPECT_NE(json.find("\"min_ns\":1,\"max_ns\":1000,"), std::string::npos) << json;
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
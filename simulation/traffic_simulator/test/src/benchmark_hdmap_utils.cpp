@@ -0,0 +1,257 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <random>
+#include <scenario_simulator_exception/exception.hpp>
+#include <string>
+#include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+#include <vector>
+
+/**
+ * @note Run with --benchmark_format=json (or --benchmark_out=<file>) for machine readable results.
+ * Every benchmark reads the same seeded inputs, so results are comparable across releases.
+ */
+namespace
+{
+constexpr std::size_t number_of_inputs = 256;
+
+constexpr std::mt19937::result_type seed = 0;
+
+auto hdmapUtils() -> const hdmap_utils::HdMapUtils &
+{
+  static const auto hdmap_utils = []() {
+    geographic_msgs::msg::GeoPoint origin;
+    origin.latitude = 35.61836750154;
+    origin.longitude = 139.78066608243;
+    return hdmap_utils::HdMapUtils(
+      ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm",
+      origin);
+  }();
+  return hdmap_utils;
+}
+
+/**
+ * @note The test map has no neighbouring lanelets in the same direction, so lane changes are
+ * measured on the kashiwanoha map, which the lane change scenarios use.
+ */
+auto laneChangeHdmapUtils() -> const hdmap_utils::HdMapUtils &
+{
+  static const auto hdmap_utils = hdmap_utils::HdMapUtils(
+    ament_index_cpp::get_package_share_directory("kashiwanoha_map") + "/map/lanelet2_map.osm",
+    geographic_msgs::msg::GeoPoint());
+  return hdmap_utils;
+}
+
+/// @note Lanelet poses on the centerline of randomly chosen lanelets.
+auto laneletPoses() -> const std::vector<traffic_simulator_msgs::msg::LaneletPose> &
+{
+  static const auto lanelet_poses = []() {
+    std::mt19937 engine(seed);
+    const auto lanelet_ids = hdmapUtils().getLaneletIds();
+    std::uniform_int_distribution<std::size_t> lanelet_index(0, lanelet_ids.size() - 1);
+    std::uniform_real_distribution<double> ratio(0.0, 1.0);
+    std::vector<traffic_simulator_msgs::msg::LaneletPose> lanelet_poses;
+    for (std::size_t i = 0; i < number_of_inputs; ++i) {
+      const auto lanelet_id = lanelet_ids[lanelet_index(engine)];
+      lanelet_poses.emplace_back(traffic_simulator::helper::constructLaneletPose(
+        lanelet_id, ratio(engine) * hdmapUtils().getLaneletLength(lanelet_id), 0.0));
+    }
+    return lanelet_poses;
+  }();
+  return lanelet_poses;
+}
+
+auto mapPoses() -> const std::vector<geometry_msgs::msg::Pose> &
+{
+  static const auto map_poses = []() {
+    std::vector<geometry_msgs::msg::Pose> map_poses;
+    for (const auto & lanelet_pose : laneletPoses()) {
+      map_poses.emplace_back(hdmapUtils().toMapPose(lanelet_pose).pose);
+    }
+    return map_poses;
+  }();
+  return map_poses;
+}
+
+auto boundingBox() -> traffic_simulator_msgs::msg::BoundingBox
+{
+  traffic_simulator_msgs::msg::BoundingBox bbox;
+  bbox.center.x = 1.0;
+  bbox.dimensions.x = 4.0;
+  bbox.dimensions.y = 2.0;
+  bbox.dimensions.z = 1.5;
+  return bbox;
+}
+
+/// @note Routes of 100m from each of the lanelet poses.
+auto routes() -> const std::vector<std::vector<std::int64_t>> &
+{
+  static const auto routes = []() {
+    std::vector<std::vector<std::int64_t>> routes;
+    for (const auto & lanelet_pose : laneletPoses()) {
+      routes.emplace_back(hdmapUtils().getFollowingLanelets(lanelet_pose.lanelet_id));
+    }
+    return routes;
+  }();
+  return routes;
+}
+
+/// @note Lanelet poses on randomly chosen lane changeable lanelets, paired with the target.
+auto laneChangeInputs() -> const std::vector<
+  std::pair<traffic_simulator_msgs::msg::LaneletPose, traffic_simulator::lane_change::Parameter>> &
+{
+  static const auto inputs = []() {
+    std::vector<std::pair<std::int64_t, std::int64_t>> lane_changes;
+    for (const auto lanelet_id : laneChangeHdmapUtils().getLaneletIds()) {
+      for (const auto direction :
+           {traffic_simulator::lane_change::Direction::LEFT,
+            traffic_simulator::lane_change::Direction::RIGHT}) {
+        if (const auto target =
+              laneChangeHdmapUtils().getLaneChangeableLaneletId(lanelet_id, direction)) {
+          lane_changes.emplace_back(lanelet_id, target.value());
+        }
+      }
+    }
+    if (lane_changes.empty()) {
+      THROW_SIMULATION_ERROR("There is no lane changeable lanelet in the map.");
+    }
+    std::mt19937 engine(seed);
+    std::uniform_int_distribution<std::size_t> lane_change_index(0, lane_changes.size() - 1);
+    std::uniform_real_distribution<double> ratio(0.0, 1.0);
+    std::vector<std::pair<
+      traffic_simulator_msgs::msg::LaneletPose, traffic_simulator::lane_change::Parameter>>
+      inputs;
+    for (std::size_t i = 0; i < number_of_inputs; ++i) {
+      const auto [lanelet_id, target] = lane_changes[lane_change_index(engine)];
+      inputs.emplace_back(
+        traffic_simulator::helper::constructLaneletPose(
+          lanelet_id, ratio(engine) * laneChangeHdmapUtils().getLaneletLength(lanelet_id), 0.0),
+        traffic_simulator::lane_change::Parameter(
+          traffic_simulator::lane_change::AbsoluteTarget(target)));
+    }
+    return inputs;
+  }();
+  return inputs;
+}
+}  // namespace
+
+static void ToLaneletPose(benchmark::State & state)
+{
+  const auto bbox = boundingBox();
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+      hdmapUtils().toLaneletPose(mapPoses()[i++ % number_of_inputs], bbox, false));
+  }
+}
+BENCHMARK(ToLaneletPose);
+
+static void MatchToLane(benchmark::State & state)
+{
+  const auto bbox = boundingBox();
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+      hdmapUtils().matchToLane(mapPoses()[i++ % number_of_inputs], bbox, false));
+  }
+}
+BENCHMARK(MatchToLane);
+
+static void GetRoute(benchmark::State & state)
+{
+  std::size_t i = 0;
+  for (auto _ : state) {
+    const auto & from = laneletPoses()[i % number_of_inputs];
+    const auto & to = laneletPoses()[(i + 1) % number_of_inputs];
+    benchmark::DoNotOptimize(hdmapUtils().getRoute(from.lanelet_id, to.lanelet_id));
+    ++i;
+  }
+}
+BENCHMARK(GetRoute);
+
+static void GetLongitudinalDistance(benchmark::State & state)
+{
+  std::size_t i = 0;
+  for (auto _ : state) {
+    const auto & from = laneletPoses()[i % number_of_inputs];
+    const auto & to = laneletPoses()[(i + 1) % number_of_inputs];
+    benchmark::DoNotOptimize(hdmapUtils().getLongitudinalDistance(from, to));
+    ++i;
+  }
+}
+BENCHMARK(GetLongitudinalDistance);
+
+static void GetFollowingLanelets(benchmark::State & state)
+{
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+      hdmapUtils().getFollowingLanelets(laneletPoses()[i++ % number_of_inputs].lanelet_id));
+  }
+}
+BENCHMARK(GetFollowingLanelets);
+
+static void GetCenterPointsSpline(benchmark::State & state)
+{
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+      hdmapUtils().getCenterPointsSpline(laneletPoses()[i++ % number_of_inputs].lanelet_id));
+  }
+}
+BENCHMARK(GetCenterPointsSpline);
+
+static void ClipTrajectoryFromLaneletIds(benchmark::State & state)
+{
+  std::size_t i = 0;
+  for (auto _ : state) {
+    const auto & lanelet_pose = laneletPoses()[i % number_of_inputs];
+    benchmark::DoNotOptimize(hdmapUtils().clipTrajectoryFromLaneletIds(
+      lanelet_pose.lanelet_id, lanelet_pose.s, routes()[i % number_of_inputs]));
+    ++i;
+  }
+}
+BENCHMARK(ClipTrajectoryFromLaneletIds);
+
+static void GetDistanceToStopLine(benchmark::State & state)
+{
+  std::vector<math::geometry::CatmullRomSpline> splines;
+  for (const auto & route : routes()) {
+    splines.emplace_back(hdmapUtils().getCenterPoints(route));
+  }
+  std::size_t i = 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(hdmapUtils().getDistanceToStopLine(
+      routes()[i % number_of_inputs], splines[i % number_of_inputs]));
+    ++i;
+  }
+}
+BENCHMARK(GetDistanceToStopLine);
+
+static void GetLaneChangeTrajectory(benchmark::State & state)
+{
+  std::size_t i = 0;
+  for (auto _ : state) {
+    const auto & [lanelet_pose, parameter] = laneChangeInputs()[i++ % number_of_inputs];
+    benchmark::DoNotOptimize(
+      laneChangeHdmapUtils().getLaneChangeTrajectory(lanelet_pose, parameter));
+  }
+}
+BENCHMARK(GetLaneChangeTrajectory);
+
+BENCHMARK_MAIN();
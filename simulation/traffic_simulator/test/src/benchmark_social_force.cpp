@@ -0,0 +1,80 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <memory>
+#include <quaternion_operation/quaternion_operation.h>
+#include <random>
+#include <string>
+#include <traffic_simulator/behavior/social_force.hpp>
+#include <vector>
+
+namespace
+{
+constexpr std::mt19937::result_type seed = 0;
+
+constexpr double step_time = 0.05;
+
+/// @note Pedestrians walking in random directions in a square with about 0.5 pedestrians per m^2.
+auto makeCrowd(std::size_t number_of_pedestrians) -> std::vector<traffic_simulator::EntityStatus>
+{
+  std::mt19937 engine(seed);
+  const auto size = std::sqrt(number_of_pedestrians / 0.5);
+  std::uniform_real_distribution<double> position(0.0, size);
+  std::uniform_real_distribution<double> yaw(-M_PI, M_PI);
+  std::vector<traffic_simulator::EntityStatus> statuses;
+  for (std::size_t i = 0; i < number_of_pedestrians; ++i) {
+    traffic_simulator::EntityStatus status;
+    status.name = "pedestrian" + std::to_string(i);
+    status.pose.position.x = position(engine);
+    status.pose.position.y = position(engine);
+    geometry_msgs::msg::Vector3 rpy;
+    rpy.z = yaw(engine);
+    status.pose.orientation = quaternion_operation::convertEulerAngleToQuaternion(rpy);
+    status.bounding_box.dimensions.x = 0.5;
+    status.bounding_box.dimensions.y = 0.5;
+    status.bounding_box.dimensions.z = 1.8;
+    status.action_status.twist.linear.x = 1.2;
+    status.lanelet_pose_valid = false;
+    statuses.push_back(status);
+  }
+  return statuses;
+}
+}  // namespace
+
+/// @note One frame of the whole crowd, including filling the snapshot shared by the pedestrians.
+static void UpdateCrowd(benchmark::State & state)
+{
+  auto statuses = makeCrowd(state.range(0));
+  const auto behavior_parameter = traffic_simulator_msgs::msg::BehaviorParameter();
+  auto snapshot = std::make_shared<traffic_simulator::EntityStatusSnapshot>();
+  for (auto _ : state) {
+    snapshot->clear();
+    for (const auto & status : statuses) {
+      snapshot->emplace(status.name, traffic_simulator::CanonicalizedEntityStatus(status, nullptr));
+    }
+    for (auto & status : statuses) {
+      status = traffic_simulator::social_force::makeUpdatedStatus(
+        snapshot->at(status.name), 1.2,
+        traffic_simulator::OtherEntityStatusView(snapshot, status.name), behavior_parameter,
+        step_time);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(UpdateCrowd)->Arg(100)->Arg(1000)->Arg(3000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,242 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <cmath>
+#include <iterator>
+#include <memory>
+#include <scenario_simulator_exception/exception.hpp>
+#include <set>
+#include <string>
+#include <traffic_simulator/data_type/entity_status_snapshot.hpp>
+#include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+#include <vector>
+
+auto makeSnapshot(const std::vector<std::string> & names)
+  -> std::shared_ptr<traffic_simulator::EntityStatusSnapshot>
+{
+  auto snapshot = std::make_shared<traffic_simulator::EntityStatusSnapshot>();
+  for (const auto & name : names) {
+    traffic_simulator::EntityStatus status;
+    status.name = name;
+    status.lanelet_pose_valid = false;
+    snapshot->emplace(name, traffic_simulator::CanonicalizedEntityStatus(status, nullptr));
+  }
+  return snapshot;
+}
+
+auto makeEntityStatus(const std::string & name, double x, double y)
+  -> traffic_simulator::CanonicalizedEntityStatus
+{
+  traffic_simulator::EntityStatus status;
+  status.name = name;
+  status.pose.position.x = x;
+  status.pose.position.y = y;
+  status.bounding_box.dimensions.x = 4.0;
+  status.bounding_box.dimensions.y = 2.0;
+  status.lanelet_pose_valid = false;
+  return traffic_simulator::CanonicalizedEntityStatus(status, nullptr);
+}
+
+TEST(EntityStatusSnapshot, Lookup)
+{
+  const auto snapshot = makeSnapshot({"ego", "npc1", "npc2"});
+  EXPECT_EQ(snapshot->size(), 3U);
+  EXPECT_EQ(snapshot->indexOf("npc1"), 1U);
+  EXPECT_FALSE(snapshot->indexOf("npc3"));
+  EXPECT_EQ(static_cast<traffic_simulator::EntityStatus>(snapshot->at("npc2")).name, "npc2");
+  EXPECT_EQ(snapshot->find("npc3"), snapshot->end());
+  EXPECT_THROW(snapshot->at("npc3"), common::SimulationError);
+  EXPECT_THROW(snapshot->emplace("ego", snapshot->at("ego")), common::SimulationError);
+  snapshot->clear();
+  EXPECT_TRUE(snapshot->empty());
+  EXPECT_FALSE(snapshot->indexOf("ego"));
+}
+
+TEST(EntityStatusSnapshot, OtherEntityStatusView)
+{
+  const auto snapshot = makeSnapshot({"ego", "npc1", "npc2"});
+  for (const auto & owner : {"ego", "npc1", "npc2"}) {
+    const traffic_simulator::OtherEntityStatusView view(snapshot, owner);
+    EXPECT_EQ(view.size(), 2U);
+    EXPECT_EQ(view.count(owner), 0U);
+    EXPECT_EQ(view.find(owner), view.end());
+    EXPECT_THROW(view.at(owner), common::SimulationError);
+    std::set<std::string> names;
+    for (const auto & [name, status] : view) {
+      EXPECT_EQ(static_cast<traffic_simulator::EntityStatus>(status).name, name);
+      names.insert(name);
+    }
+    EXPECT_EQ(names.size(), 2U);
+    EXPECT_EQ(names.count(owner), 0U);
+  }
+}
+
+TEST(EntityStatusSnapshot, OtherEntityStatusViewWithoutOwner)
+{
+  const auto snapshot = makeSnapshot({"npc1", "npc2"});
+  const traffic_simulator::OtherEntityStatusView view(snapshot, "ego");
+  EXPECT_EQ(view.size(), 2U);
+  EXPECT_EQ(view.count("npc1"), 1U);
+  EXPECT_EQ(std::distance(view.begin(), view.end()), 2);
+  EXPECT_TRUE(traffic_simulator::OtherEntityStatusView().empty());
+  EXPECT_EQ(
+    traffic_simulator::OtherEntityStatusView().begin(),
+    traffic_simulator::OtherEntityStatusView().end());
+}
+
+TEST(EntityStatusSnapshot, IndicesWithin)
+{
+  traffic_simulator::EntityStatusSnapshot snapshot;
+  std::vector<geometry_msgs::msg::Point> positions;
+  for (int i = 0; i < 100; ++i) {
+    geometry_msgs::msg::Point position;
+    position.x = (i % 10) * 13.0 - 60.0;
+    position.y = (i / 10) * 7.0 - 30.0;
+    positions.push_back(position);
+    snapshot.emplace("npc" + std::to_string(i), makeEntityStatus("npc", position.x, position.y));
+  }
+  EXPECT_DOUBLE_EQ(snapshot.getMaximumBoundingRadius(), std::hypot(2.0, 1.0));
+  for (const double radius : {0.0, 5.0, 19.9, 20.0, 45.0, 1000.0}) {
+    geometry_msgs::msg::Point center;
+    center.x = 1.5;
+    center.y = -2.0;
+    std::vector<std::size_t> expected;
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+      if (std::hypot(positions[i].x - center.x, positions[i].y - center.y) <= radius) {
+        expected.push_back(i);
+      }
+    }
+    EXPECT_EQ(snapshot.indicesWithin(center, radius), expected);
+  }
+}
+
+TEST(EntityStatusSnapshot, GetEntitiesWithin)
+{
+  auto snapshot = std::make_shared<traffic_simulator::EntityStatusSnapshot>();
+  snapshot->emplace("ego", makeEntityStatus("ego", 0.0, 0.0));
+  snapshot->emplace("near", makeEntityStatus("near", 10.0, 0.0));
+  snapshot->emplace("far", makeEntityStatus("far", 100.0, 0.0));
+  const traffic_simulator::OtherEntityStatusView view(snapshot, "ego");
+  const auto entities = view.getEntitiesWithin(geometry_msgs::msg::Point(), 50.0);
+  ASSERT_EQ(entities.size(), 1U);
+  EXPECT_EQ(entities.front()->first, "near");
+  EXPECT_TRUE(view.getEntitiesOnLanelets({34513}).empty());
+}
+
+TEST(EntityStatusSnapshot, ExistsOnLanelets)
+{
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  const auto hdmap_utils = std::make_shared<hdmap_utils::HdMapUtils>(
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm",
+    origin);
+  const auto makeLaneMatchedEntityStatus = [&](const std::string & name, std::int64_t lanelet_id) {
+    traffic_simulator::EntityStatus status;
+    status.name = name;
+    status.lanelet_pose = traffic_simulator::helper::constructLaneletPose(lanelet_id, 5.0, 0.0);
+    status.lanelet_pose_valid = true;
+    status.pose = hdmap_utils->toMapPose(status.lanelet_pose).pose;
+    return traffic_simulator::CanonicalizedEntityStatus(status, hdmap_utils);
+  };
+  auto snapshot = std::make_shared<traffic_simulator::EntityStatusSnapshot>();
+  snapshot->emplace("ego", makeLaneMatchedEntityStatus("ego", 34513));
+  snapshot->emplace("npc", makeLaneMatchedEntityStatus("npc", 34684));
+  snapshot->emplace("unmatched", makeEntityStatus("unmatched", 0.0, 0.0));
+  EXPECT_EQ(snapshot->indicesOnLanelet(34513), std::vector<std::size_t>({0}));
+  EXPECT_TRUE(snapshot->indicesOnLanelet(34579).empty());
+
+  const traffic_simulator::OtherEntityStatusView view(snapshot, "ego");
+  for (const auto & lanelet_ids : std::vector<std::vector<std::int64_t>>{
+         {}, {34513}, {34684}, {34579}, {34513, 34684}, {34579, 34684, 34684}}) {
+    EXPECT_EQ(view.existsOnLanelets(lanelet_ids), !view.getEntitiesOnLanelets(lanelet_ids).empty());
+  }
+  EXPECT_FALSE(view.existsOnLanelets({34513}));
+  EXPECT_TRUE(view.existsOnLanelets({34513, 34684}));
+  EXPECT_FALSE(traffic_simulator::OtherEntityStatusView().existsOnLanelets({34513}));
+}
+
+TEST(EntityStatusSnapshot, ClearKeepsStorage)
+{
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  const auto hdmap_utils = std::make_shared<hdmap_utils::HdMapUtils>(
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm",
+    origin);
+  const auto makeLaneMatchedEntityStatus = [&](const std::string & name, double s) {
+    traffic_simulator::EntityStatus status;
+    status.name = name;
+    status.lanelet_pose = traffic_simulator::helper::constructLaneletPose(34513, s, 0.0);
+    status.lanelet_pose_valid = true;
+    status.pose = hdmap_utils->toMapPose(status.lanelet_pose).pose;
+    return traffic_simulator::CanonicalizedEntityStatus(status, hdmap_utils);
+  };
+  traffic_simulator::EntityStatusSnapshot snapshot;
+  snapshot.emplace("ego", makeLaneMatchedEntityStatus("ego", 1.0));
+  snapshot.emplace("npc", makeLaneMatchedEntityStatus("npc", 5.0));
+  const auto * const bucket = &snapshot.indicesOnLanelet(34513);
+  const auto * const bucket_data = bucket->data();
+  const auto * const entry = &snapshot[0];
+
+  snapshot.clear();
+  EXPECT_TRUE(snapshot.empty());
+  EXPECT_FALSE(snapshot.indexOf("ego"));
+  EXPECT_TRUE(snapshot.indicesOnLanelet(34513).empty());
+
+  snapshot.emplace("npc", makeLaneMatchedEntityStatus("npc", 6.0));
+  snapshot.emplace("ego", makeLaneMatchedEntityStatus("ego", 2.0));
+  EXPECT_EQ(snapshot.indexOf("npc"), 0U);
+  EXPECT_EQ(snapshot.indexOf("ego"), 1U);
+  EXPECT_THROW(snapshot.emplace("ego", makeEntityStatus("ego", 0.0, 0.0)), common::SimulationError);
+  EXPECT_EQ(&snapshot.indicesOnLanelet(34513), bucket);
+  EXPECT_EQ(snapshot.indicesOnLanelet(34513).data(), bucket_data);
+  EXPECT_EQ(&snapshot[0], entry);
+}
+
+/// @note Same use of the pool as EntityManager::update, with the references kept by the entities.
+TEST(EntityStatusSnapshot, PoolReusesSnapshots)
+{
+  traffic_simulator::EntityStatusSnapshotPool pool;
+  /// @note Snapshot published last, kept by the entities, and snapshot kept by behavior plugins.
+  std::shared_ptr<const traffic_simulator::EntityStatusSnapshot> published, plugin_snapshot;
+  std::set<const traffic_simulator::EntityStatusSnapshot *> snapshots;
+  for (int frame = 0; frame < 10; ++frame) {
+    const auto current_status = pool.acquire();
+    current_status->emplace("ego", makeEntityStatus("ego", frame, 0.0));
+    EXPECT_NE(current_status, published);
+    EXPECT_NE(current_status, plugin_snapshot);
+    published = current_status;
+    plugin_snapshot = published;
+    const auto updated_status = pool.acquire();
+    EXPECT_TRUE(updated_status->empty());
+    EXPECT_NE(updated_status, current_status);
+    updated_status->emplace("ego", makeEntityStatus("ego", frame + 1.0, 0.0));
+    published = updated_status;
+    snapshots.insert(current_status.get());
+    snapshots.insert(updated_status.get());
+  }
+  EXPECT_EQ(pool.size(), 3U);
+  EXPECT_EQ(snapshots.size(), 3U);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
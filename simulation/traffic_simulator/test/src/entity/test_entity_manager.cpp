@@ -0,0 +1,280 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <boost/filesystem.hpp>
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <random>
+#include <rclcpp/rclcpp.hpp>
+#include <scenario_simulator_exception/exception.hpp>
+#include <string>
+#include <traffic_simulator/entity/entity_manager.hpp>
+#include <utility>
+#include <vector>
+
+#include "../catalogs.hpp"
+#include "../expect_eq_macros.hpp"
+
+using traffic_simulator::entity::EntityManager;
+using traffic_simulator::entity::MiscObjectEntity;
+
+/**
+ * @note Configuration requires a point cloud map next to the lanelet map, which EntityManager never
+ * reads, so the lanelet map of this package is copied to a directory with an empty one.
+ */
+auto makeConfiguration() -> traffic_simulator::Configuration
+{
+  const auto map_path =
+    boost::filesystem::temp_directory_path() / boost::filesystem::unique_path("map-%%%%-%%%%");
+  boost::filesystem::create_directories(map_path);
+  boost::filesystem::copy_file(
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm",
+    map_path / "lanelet2_map.osm");
+  std::ofstream((map_path / "pointcloud_map.pcd").string());
+  return traffic_simulator::Configuration(map_path);
+}
+
+auto makeNode(const std::string & name) -> std::shared_ptr<rclcpp::Node>
+{
+  rclcpp::NodeOptions options;
+  options.parameter_overrides(
+    {{"origin_latitude", 35.61836750154}, {"origin_longitude", 139.78066608243}});
+  return std::make_shared<rclcpp::Node>(name, options);
+}
+
+auto makePose(double x, double y, double yaw = 0.0) -> geometry_msgs::msg::Pose
+{
+  geometry_msgs::msg::Pose pose;
+  pose.position.x = x;
+  pose.position.y = y;
+  pose.orientation.z = std::sin(yaw / 2.0);
+  pose.orientation.w = std::cos(yaw / 2.0);
+  return pose;
+}
+
+TEST(EntityManager, HandleQueriesMatchNameQueries)
+{
+  const auto node = makeNode("HandleQueriesMatchNameQueries");
+  EntityManager manager(node, makeConfiguration());
+  manager.spawnEntity<MiscObjectEntity>("a", makePose(0.0, 0.0), getMiscObjectParameters());
+  manager.spawnEntity<MiscObjectEntity>("b", makePose(3.0, 1.0, 0.5), getMiscObjectParameters());
+  manager.spawnEntity<MiscObjectEntity>("c", makePose(0.5, 0.2), getMiscObjectParameters());
+  const auto a = manager.getEntityHandle("a");
+  const auto b = manager.getEntityHandle("b");
+  const auto c = manager.getEntityHandle("c");
+  EXPECT_TRUE(manager.entityExists(a));
+  EXPECT_NE(a, b);
+  EXPECT_POSE_EQ(manager.getMapPose(b), manager.getMapPose("b"));
+  EXPECT_EQ(manager.getBoundingBoxDistance(a, b), manager.getBoundingBoxDistance("a", "b"));
+  EXPECT_POSE_EQ(manager.getRelativePose(a, b), manager.getRelativePose("a", "b"));
+  EXPECT_FALSE(manager.checkCollision(a, b));
+  EXPECT_TRUE(manager.checkCollision(a, c));
+  EXPECT_FALSE(manager.checkCollision(a, a));
+}
+
+TEST(EntityManager, StaleHandleIsRejected)
+{
+  const auto node = makeNode("StaleHandleIsRejected");
+  EntityManager manager(node, makeConfiguration());
+  manager.spawnEntity<MiscObjectEntity>("a", makePose(0.0, 0.0), getMiscObjectParameters());
+  manager.spawnEntity<MiscObjectEntity>("b", makePose(3.0, 0.0), getMiscObjectParameters());
+  const auto a = manager.getEntityHandle("a");
+  const auto b = manager.getEntityHandle("b");
+  manager.despawnEntity("a");
+  EXPECT_FALSE(manager.entityExists(a));
+  EXPECT_TRUE(manager.entityExists(b));
+  EXPECT_THROW(manager.getEntityHandle("a"), common::SemanticError);
+  EXPECT_THROW(manager.getMapPose(a), common::SemanticError);
+  EXPECT_THROW(manager.getBoundingBoxDistance(a, b), common::SemanticError);
+  EXPECT_THROW(manager.getRelativePose(b, a), common::SemanticError);
+  EXPECT_THROW(manager.checkCollision(a, b), common::SemanticError);
+  EXPECT_FALSE(manager.entityExists(traffic_simulator::entity::EntityHandle()));
+}
+
+TEST(EntityManager, HandleSlotIsReused)
+{
+  const auto node = makeNode("HandleSlotIsReused");
+  EntityManager manager(node, makeConfiguration());
+  manager.spawnEntity<MiscObjectEntity>("a", makePose(0.0, 0.0), getMiscObjectParameters());
+  manager.spawnEntity<MiscObjectEntity>("b", makePose(3.0, 0.0), getMiscObjectParameters());
+  const auto a = manager.getEntityHandle("a");
+  manager.despawnEntity("a");
+
+  /// @note A new entity takes the slot of the despawned one, which the old handle never reaches.
+  manager.spawnEntity<MiscObjectEntity>("c", makePose(10.0, 0.0), getMiscObjectParameters());
+  const auto c = manager.getEntityHandle("c");
+  EXPECT_EQ(c.index, a.index);
+  EXPECT_NE(c.generation, a.generation);
+  EXPECT_FALSE(manager.entityExists(a));
+  EXPECT_POSE_EQ(manager.getMapPose(c), makePose(10.0, 0.0));
+  EXPECT_THROW(manager.getMapPose(a), common::SemanticError);
+
+  /// @note An entity spawned again with the same name gets a new handle.
+  manager.spawnEntity<MiscObjectEntity>("a", makePose(20.0, 0.0), getMiscObjectParameters());
+  const auto respawned = manager.getEntityHandle("a");
+  EXPECT_NE(respawned, a);
+  EXPECT_FALSE(manager.entityExists(a));
+  EXPECT_POSE_EQ(manager.getMapPose(respawned), makePose(20.0, 0.0));
+}
+
+auto makeMiscObjectParameters(double length, double width)
+  -> traffic_simulator_msgs::msg::MiscObjectParameters
+{
+  auto parameters = getMiscObjectParameters();
+  parameters.bounding_box.dimensions.x = length;
+  parameters.bounding_box.dimensions.y = width;
+  return parameters;
+}
+
+/// @note The broad phase of updateCollidingEntities finds the same pairs as checking all pairs.
+TEST(EntityManager, CollidingEntitiesMatchAllPairs)
+{
+  const auto node = makeNode("CollidingEntitiesMatchAllPairs");
+  EntityManager manager(node, makeConfiguration());
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> position(-30.0, 30.0), yaw(-M_PI, M_PI),
+    size(0.5, 6.0);
+  std::vector<std::string> names;
+  for (int i = 0; i < 80; ++i) {
+    names.push_back("random" + std::to_string(i));
+    manager.spawnEntity<MiscObjectEntity>(
+      names.back(), makePose(position(engine), position(engine), yaw(engine)),
+      makeMiscObjectParameters(size(engine), size(engine)));
+  }
+  /// @note Entities straddling the boundaries of the cells of EntityStatusSnapshot.
+  const auto cell_size = traffic_simulator::EntityStatusSnapshot::grid_cell_size;
+  for (const auto & [name, pose] : std::vector<std::pair<std::string, geometry_msgs::msg::Pose>>{
+         {"straddling_x0", makePose(cell_size - 0.5, 45.0, M_PI / 4.0)},
+         {"straddling_x1", makePose(cell_size + 1.0, 45.5)},
+         {"straddling_y0", makePose(45.0, cell_size - 0.3)},
+         {"straddling_y1", makePose(45.0, cell_size + 0.3, M_PI / 2.0)},
+         {"straddling_xy0", makePose(cell_size - 0.2, cell_size - 0.2, M_PI / 6.0)},
+         {"straddling_xy1", makePose(cell_size + 0.2, cell_size + 0.2, -M_PI / 3.0)}}) {
+    names.push_back(name);
+    manager.spawnEntity<MiscObjectEntity>(name, pose, makeMiscObjectParameters(2.0, 1.0));
+  }
+  manager.update(0.0, 0.1);
+
+  std::size_t collision_count = 0;
+  for (const auto & name : names) {
+    std::vector<std::string> expected;
+    for (const auto & other : names) {
+      if (other != name and manager.checkCollision(name, other)) {
+        expected.push_back(other);
+      }
+    }
+    std::sort(expected.begin(), expected.end());
+    const auto colliding_entities = manager.getCollidingEntities(name);
+    EXPECT_EQ(colliding_entities, expected) << name;
+    EXPECT_EQ(
+      std::find(colliding_entities.begin(), colliding_entities.end(), name),
+      colliding_entities.end());
+    collision_count += expected.size();
+  }
+  EXPECT_GT(collision_count, 0U);
+  for (const auto & [name, other] : std::vector<std::pair<std::string, std::string>>{
+         {"straddling_x0", "straddling_x1"},
+         {"straddling_y0", "straddling_y1"},
+         {"straddling_xy0", "straddling_xy1"}}) {
+    const auto colliding_entities = manager.getCollidingEntities(name);
+    EXPECT_NE(
+      std::find(colliding_entities.begin(), colliding_entities.end(), other),
+      colliding_entities.end())
+      << name;
+  }
+}
+
+/// @note An entity never collides with itself, even when it is alone.
+TEST(EntityManager, NoSelfCollision)
+{
+  const auto node = makeNode("NoSelfCollision");
+  EntityManager manager(node, makeConfiguration());
+  manager.spawnEntity<MiscObjectEntity>("a", makePose(0.0, 0.0), getMiscObjectParameters());
+  manager.update(0.0, 0.1);
+  EXPECT_TRUE(manager.getCollidingEntities("a").empty());
+  EXPECT_FALSE(manager.checkCollision("a", "a"));
+}
+
+/// @note Entities moved, despawned or spawned after the last update are not judged by old poses.
+TEST(EntityManager, CollidingEntitiesFollowChangesBetweenUpdates)
+{
+  const auto node = makeNode("CollidingEntitiesFollowChangesBetweenUpdates");
+  EntityManager manager(node, makeConfiguration());
+  manager.spawnEntity<MiscObjectEntity>("a", makePose(0.0, 0.0), getMiscObjectParameters());
+  manager.spawnEntity<MiscObjectEntity>("b", makePose(10.0, 0.0), getMiscObjectParameters());
+  manager.spawnEntity<MiscObjectEntity>("c", makePose(0.5, 0.2), getMiscObjectParameters());
+  manager.update(0.0, 0.1);
+  EXPECT_EQ(manager.getCollidingEntities("a"), (std::vector<std::string>{"c"}));
+
+  auto status = static_cast<traffic_simulator::EntityStatus>(manager.getEntityStatus("b"));
+  status.pose = makePose(0.3, -0.2);
+  status.lanelet_pose_valid = false;
+  manager.setEntityStatus(
+    "b", traffic_simulator::CanonicalizedEntityStatus(status, manager.getHdmapUtils()));
+  EXPECT_EQ(manager.getCollidingEntities("a"), (std::vector<std::string>{"b", "c"}));
+  EXPECT_EQ(manager.getCollidingEntities("b"), (std::vector<std::string>{"a", "c"}));
+
+  /// @note An entity spawned again with the same name does not inherit the collisions.
+  manager.update(0.1, 0.1);
+  manager.despawnEntity("c");
+  manager.spawnEntity<MiscObjectEntity>("c", makePose(20.0, 0.0), getMiscObjectParameters());
+  EXPECT_EQ(manager.getCollidingEntities("a"), (std::vector<std::string>{"b"}));
+  EXPECT_TRUE(manager.getCollidingEntities("c").empty());
+  manager.update(0.2, 0.1);
+  EXPECT_EQ(manager.getCollidingEntities("a"), (std::vector<std::string>{"b"}));
+  EXPECT_TRUE(manager.getCollidingEntities("c").empty());
+}
+
+TEST(EntityManager, GetEntityNamesByType)
+{
+  const auto node = makeNode("GetEntityNamesByType");
+  EntityManager manager(node, makeConfiguration());
+  const auto makeEntityType = [](auto type) {
+    traffic_simulator_msgs::msg::EntityType entity_type;
+    entity_type.type = type;
+    return entity_type;
+  };
+  const auto misc_object = makeEntityType(traffic_simulator_msgs::msg::EntityType::MISC_OBJECT);
+  const auto vehicle = makeEntityType(traffic_simulator_msgs::msg::EntityType::VEHICLE);
+  EXPECT_TRUE(manager.getEntityNames(misc_object).empty());
+
+  for (const auto & name : {"c", "a", "b"}) {
+    manager.spawnEntity<MiscObjectEntity>(name, makePose(0.0, 0.0), getMiscObjectParameters());
+  }
+  EXPECT_EQ(manager.getEntityNames(misc_object), (std::vector<std::string>{"c", "a", "b"}));
+  EXPECT_TRUE(manager.getEntityNames(vehicle).empty());
+  EXPECT_EQ(manager.getEntityTypeList().size(), 3U);
+  EXPECT_EQ(manager.getEntityTypeList().at("a").type, misc_object.type);
+
+  /// @note A despawned entity is removed, and spawned again it comes last.
+  manager.despawnEntity("a");
+  EXPECT_EQ(manager.getEntityNames(misc_object), (std::vector<std::string>{"c", "b"}));
+  EXPECT_EQ(manager.getEntityTypeList().count("a"), 0U);
+  manager.update(0.0, 0.1);
+  manager.spawnEntity<MiscObjectEntity>("a", makePose(0.0, 0.0), getMiscObjectParameters());
+  EXPECT_EQ(manager.getEntityNames(misc_object), (std::vector<std::string>{"c", "b", "a"}));
+  EXPECT_EQ(manager.getEntityTypeList().size(), 3U);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  rclcpp::init(argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,85 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <traffic_simulator/job/job_list.hpp>
+
+/// @note Counts the instances alive, to check that finished and replaced jobs are destroyed.
+struct InstanceCounter
+{
+  static inline int count = 0;
+  InstanceCounter() noexcept { ++count; }
+  InstanceCounter(const InstanceCounter &) noexcept { ++count; }
+  InstanceCounter(InstanceCounter &&) noexcept { ++count; }
+  ~InstanceCounter() { --count; }
+};
+
+TEST(JobList, MemoryStaysFlat)
+{
+  traffic_simulator::job::JobList job_list;
+  int cleanups = 0;
+  for (int i = 0; i < 1'000'000; ++i) {
+    job_list.append(
+      [counter = InstanceCounter(), name = std::string("entity")](double) { return false; },
+      [&cleanups]() { ++cleanups; }, traffic_simulator::job::Type::LINEAR_VELOCITY, true,
+      traffic_simulator::job::Event::POST_UPDATE);
+    job_list.update(0.05, traffic_simulator::job::Event::POST_UPDATE);
+    EXPECT_EQ(job_list.size(), 1U);
+    EXPECT_EQ(InstanceCounter::count, 1);
+  }
+  EXPECT_EQ(cleanups, 1'000'000 - 1);
+}
+
+TEST(JobList, EraseFinishedJobs)
+{
+  traffic_simulator::job::JobList job_list;
+  bool cleaned_up = false;
+  job_list.append(
+    [counter = InstanceCounter()](double job_duration) { return job_duration >= 0.1; },
+    [&cleaned_up]() { cleaned_up = true; }, traffic_simulator::job::Type::LINEAR_ACCELERATION,
+    true, traffic_simulator::job::Event::POST_UPDATE);
+  job_list.append(
+    [](double) { return false; }, []() {}, traffic_simulator::job::Type::OUT_OF_RANGE, true,
+    traffic_simulator::job::Event::POST_UPDATE);
+  EXPECT_EQ(job_list.size(), 2U);
+  job_list.update(0.1, traffic_simulator::job::Event::PRE_UPDATE);
+  job_list.update(0.1, traffic_simulator::job::Event::PRE_UPDATE);
+  EXPECT_EQ(job_list.size(), 2U);
+  job_list.update(0.1, traffic_simulator::job::Event::POST_UPDATE);
+  EXPECT_FALSE(cleaned_up);
+  job_list.update(0.1, traffic_simulator::job::Event::POST_UPDATE);
+  EXPECT_TRUE(cleaned_up);
+  EXPECT_EQ(job_list.size(), 1U);
+  EXPECT_EQ(InstanceCounter::count, 0);
+}
+
+TEST(JobList, KeepNonExclusiveJobs)
+{
+  traffic_simulator::job::JobList job_list;
+  job_list.append(
+    [](double) { return false; }, []() {}, traffic_simulator::job::Type::LINEAR_VELOCITY, true,
+    traffic_simulator::job::Event::POST_UPDATE);
+  job_list.append(
+    [](double) { return false; }, []() {}, traffic_simulator::job::Type::LINEAR_VELOCITY, false,
+    traffic_simulator::job::Event::POST_UPDATE);
+  EXPECT_EQ(job_list.size(), 2U);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
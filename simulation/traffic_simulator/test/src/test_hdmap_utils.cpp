@@ -14,11 +14,35 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <ament_index_cpp/get_package_share_directory.hpp>
 #include <string>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
 #include <traffic_simulator/helper/helper.hpp>
 
+namespace hdmap_utils
+{
+/// @note Access to the uncached calculations, which the cached lookups are compared with.
+class HdMapUtilsTest
+{
+public:
+  static auto calculateConflictingLaneIds(const HdMapUtils & hdmap_utils, std::int64_t lanelet_id)
+  {
+    return hdmap_utils.calculateConflictingLaneIds(lanelet_id);
+  }
+  static auto calculateConflictingCrosswalkIds(
+    const HdMapUtils & hdmap_utils, std::int64_t lanelet_id)
+  {
+    return hdmap_utils.calculateConflictingCrosswalkIds(lanelet_id);
+  }
+  static auto calculateCollisionPointInLaneCoordinate(
+    const HdMapUtils & hdmap_utils, std::int64_t lanelet_id, std::int64_t crossing_lanelet_id)
+  {
+    return hdmap_utils.calculateCollisionPointInLaneCoordinate(lanelet_id, crossing_lanelet_id);
+  }
+};
+}  // namespace hdmap_utils
+
 TEST(HdMapUtils, Construct)
 {
   std::string path =
@@ -313,6 +337,173 @@ TEST(HdMapUtils, CanonicalizeAll)
   EXPECT_EQ(canonicalized_lanelet_poses[0].s, non_canonicalized_lanelet_s);
 }
 
+/**
+ * @note Testcase for traffic light lookups using the index built on map load.
+ * Lanelet 34624 has traffic light regulatory element 34806,
+ * which refers traffic lights 34802 and 34836.
+ */
+TEST(HdMapUtils, TrafficLightIndex)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  hdmap_utils::HdMapUtils hdmap_utils(path, origin);
+
+  auto traffic_light_ids = hdmap_utils.getTrafficLightIdsOnPath({34624});
+  std::sort(traffic_light_ids.begin(), traffic_light_ids.end());
+  EXPECT_EQ(traffic_light_ids, (std::vector<std::int64_t>{34802, 34836}));
+  EXPECT_TRUE(hdmap_utils.getTrafficLightIdsOnPath({34513}).empty());
+  EXPECT_THROW(hdmap_utils.getTrafficLightIdsOnPath({34513, 0}), common::SemanticError);
+  EXPECT_THROW(hdmap_utils.getStopLineIdsOnPath({0}), common::SemanticError);
+
+  EXPECT_EQ(
+    hdmap_utils.getTrafficLightRegulatoryElementIDsFromTrafficLight(34836),
+    (std::vector<std::int64_t>{34806}));
+
+  const auto stop_lines = hdmap_utils.getTrafficLightStopLinesPoints(34802);
+  ASSERT_EQ(stop_lines.size(), static_cast<std::size_t>(1));
+  EXPECT_FALSE(stop_lines.front().empty());
+  EXPECT_THROW(hdmap_utils.getTrafficLightStopLinesPoints(0), common::SemanticError);
+}
+
+/**
+ * @note Testcase for the conflict table built on map load.
+ * Each lookup should be equal to the result calculated from the map, for every lanelet of the map.
+ */
+TEST(HdMapUtils, ConflictTable)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  hdmap_utils::HdMapUtils hdmap_utils(path, origin);
+  std::size_t collision_point_count = 0;
+  for (const auto lanelet_id : hdmap_utils.getLaneletIds()) {
+    EXPECT_EQ(
+      hdmap_utils.getConflictingLaneIds({lanelet_id}),
+      hdmap_utils::HdMapUtilsTest::calculateConflictingLaneIds(hdmap_utils, lanelet_id))
+      << "lanelet_id : " << lanelet_id;
+    const auto crosswalk_ids = hdmap_utils.getConflictingCrosswalkIds({lanelet_id});
+    EXPECT_EQ(
+      crosswalk_ids,
+      hdmap_utils::HdMapUtilsTest::calculateConflictingCrosswalkIds(hdmap_utils, lanelet_id))
+      << "lanelet_id : " << lanelet_id;
+    for (const auto crosswalk_id : crosswalk_ids) {
+      EXPECT_EQ(
+        hdmap_utils.getCollisionPointInLaneCoordinate(lanelet_id, crosswalk_id),
+        hdmap_utils::HdMapUtilsTest::calculateCollisionPointInLaneCoordinate(
+          hdmap_utils, lanelet_id, crosswalk_id))
+        << "lanelet_id : " << lanelet_id << ", crosswalk_id : " << crosswalk_id;
+      ++collision_point_count;
+    }
+  }
+  /// @note The map has crosswalks, so the collision points are actually compared.
+  EXPECT_GT(collision_point_count, static_cast<std::size_t>(0));
+}
+
+/**
+ * @note Testcase for batched toLaneletPose()/matchToLane() functions.
+ * Each result of the batched functions should be equal to the result of scalar functions.
+ */
+TEST(HdMapUtils, BatchedLaneMatching)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  hdmap_utils::HdMapUtils hdmap_utils(path, origin);
+  traffic_simulator_msgs::msg::BoundingBox bbox;
+  bbox.center.x = 1.0;
+  bbox.center.y = 0.0;
+  bbox.dimensions.x = 4.0;
+  bbox.dimensions.y = 2.0;
+  std::vector<geometry_msgs::msg::Pose> poses;
+  for (const auto id : {120659, 34411, 34513, 34981, 34636, 34651, 34630}) {
+    for (double s = 0; s < hdmap_utils.getLaneletLength(id); s = s + 2.5) {
+      for (const double offset : {-1.5, 0.0, 1.5}) {
+        poses.emplace_back(
+          hdmap_utils.toMapPose(traffic_simulator::helper::constructLaneletPose(id, s, offset))
+            .pose);
+      }
+    }
+  }
+  /// @note A pose which is far away from any lanelet.
+  poses.emplace_back(geometry_msgs::msg::Pose());
+  const std::vector<traffic_simulator_msgs::msg::BoundingBox> bboxes(poses.size(), bbox);
+  for (const std::size_t thread_count : {1, 4}) {
+    const auto lanelet_ids = hdmap_utils.matchToLane(poses, bboxes, false, 0.8, thread_count);
+    const auto lanelet_poses = hdmap_utils.toLaneletPose(poses, bboxes, false, 1.0, thread_count);
+    ASSERT_EQ(lanelet_ids.size(), poses.size());
+    ASSERT_EQ(lanelet_poses.size(), poses.size());
+    for (std::size_t i = 0; i < poses.size(); ++i) {
+      EXPECT_EQ(lanelet_ids[i], hdmap_utils.matchToLane(poses[i], bbox, false));
+      const auto lanelet_pose = hdmap_utils.toLaneletPose(poses[i], bbox, false);
+      ASSERT_EQ(lanelet_poses[i].has_value(), lanelet_pose.has_value());
+      if (lanelet_pose) {
+        EXPECT_EQ(lanelet_poses[i]->lanelet_id, lanelet_pose->lanelet_id);
+        EXPECT_DOUBLE_EQ(lanelet_poses[i]->s, lanelet_pose->s);
+        EXPECT_DOUBLE_EQ(lanelet_poses[i]->offset, lanelet_pose->offset);
+      }
+    }
+  }
+}
+
+TEST(HdMapUtils, ClipTrajectoryFromLaneletIds)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  hdmap_utils::HdMapUtils hdmap_utils(path, origin);
+  const auto route = hdmap_utils.getFollowingLanelets(34513, 100.0);
+  ASSERT_GE(route.size(), 2U);
+  const auto sample = [&](std::int64_t lanelet_id, double s) {
+    return hdmap_utils
+      .toMapPose(traffic_simulator::helper::constructLaneletPose(lanelet_id, s, 0.0))
+      .pose.position;
+  };
+  for (const double s : {0.0, 0.5, 3.25}) {
+    for (const double forward_distance : {1.0, 5.5, 20.0, 60.0}) {
+      std::vector<geometry_msgs::msg::Point> expected;
+      const double first_length = hdmap_utils.getLaneletLength(route[0]);
+      double rest_distance = forward_distance - (first_length - s);
+      for (double s_val = s; s_val < std::min(s + forward_distance, first_length);
+           s_val = s_val + 1.0) {
+        expected.emplace_back(sample(route[0], s_val));
+      }
+      for (std::size_t i = 1; i < route.size() && rest_distance > 0; ++i) {
+        const double l = hdmap_utils.getLaneletLength(route[i]);
+        for (double s_val = 0; s_val < std::min(rest_distance, l); s_val = s_val + 1.0) {
+          expected.emplace_back(sample(route[i], s_val));
+        }
+        rest_distance = rest_distance - l;
+      }
+      /// @note Called twice so that the second call is served from the centerline samples cache.
+      for (int trial = 0; trial < 2; ++trial) {
+        const auto trajectory =
+          hdmap_utils.clipTrajectoryFromLaneletIds(route[0], s, route, forward_distance);
+        const auto view =
+          hdmap_utils.clipTrajectoryViewFromLaneletIds(route[0], s, route, forward_distance);
+        ASSERT_EQ(trajectory.size(), expected.size());
+        ASSERT_EQ(view.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i) {
+          EXPECT_DOUBLE_EQ(trajectory[i].x, expected[i].x);
+          EXPECT_DOUBLE_EQ(trajectory[i].y, expected[i].y);
+          EXPECT_DOUBLE_EQ(trajectory[i].z, expected[i].z);
+          EXPECT_DOUBLE_EQ(view[i].x, expected[i].x);
+          EXPECT_DOUBLE_EQ(view[i].y, expected[i].y);
+          EXPECT_DOUBLE_EQ(view[i].z, expected[i].z);
+        }
+      }
+    }
+  }
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
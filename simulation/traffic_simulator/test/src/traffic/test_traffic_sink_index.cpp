@@ -0,0 +1,81 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <string>
+#include <traffic_simulator/traffic/traffic_controller.hpp>
+#include <traffic_simulator/traffic/traffic_sink_index.hpp>
+#include <vector>
+
+auto makeTrafficSink(double radius, double x, double y)
+  -> std::shared_ptr<traffic_simulator::traffic::TrafficSink>
+{
+  geometry_msgs::msg::Point position;
+  position.x = x;
+  position.y = y;
+  return std::make_shared<traffic_simulator::traffic::TrafficSink>(
+    radius, position, []() { return std::vector<std::string>(); },
+    [](const std::string &) { return geometry_msgs::msg::Pose(); }, [](const std::string &) {});
+}
+
+TEST(TrafficSinkIndex, SameAsTrafficSinks)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> coordinate(-100.0, 100.0);
+  std::uniform_real_distribution<double> radius(0.5, 25.0);
+  std::vector<std::shared_ptr<traffic_simulator::traffic::TrafficSink>> sinks;
+  traffic_simulator::traffic::TrafficSinkIndex index;
+  for (int i = 0; i < 50; ++i) {
+    sinks.push_back(makeTrafficSink(radius(engine), coordinate(engine), coordinate(engine)));
+    index.insert(sinks.back());
+  }
+  EXPECT_EQ(index.size(), sinks.size());
+  for (int i = 0; i < 10000; ++i) {
+    geometry_msgs::msg::Pose pose;
+    pose.position.x = coordinate(engine);
+    pose.position.y = coordinate(engine);
+    pose.position.z = coordinate(engine) * 0.1;
+    bool expected = false;
+    for (const auto & sink : sinks) {
+      expected = expected or sink->isInside(pose);
+    }
+    EXPECT_EQ(index.contains(pose), expected);
+  }
+}
+
+/// @note A sink added by addModule despawns through its own functions, not the controller's ones.
+TEST(TrafficSinkIndex, AddedSinkUsesItsOwnFunctions)
+{
+  std::vector<std::string> despawned_by_controller, despawned_by_sink;
+  traffic_simulator::traffic::TrafficController controller(
+    nullptr, []() { return std::vector<std::string>{"a"}; },
+    [](const std::string &) { return geometry_msgs::msg::Pose(); },
+    [&](const std::string & name) { despawned_by_controller.push_back(name); });
+  controller.addModule<traffic_simulator::traffic::TrafficSink>(
+    1.0, geometry_msgs::msg::Point(), []() { return std::vector<std::string>{"b"}; },
+    [](const std::string &) { return geometry_msgs::msg::Pose(); },
+    [&](const std::string & name) { despawned_by_sink.push_back(name); });
+  controller.execute();
+  EXPECT_TRUE(despawned_by_controller.empty());
+  EXPECT_EQ(despawned_by_sink, (std::vector<std::string>{"b"}));
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
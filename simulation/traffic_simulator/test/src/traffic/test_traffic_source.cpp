@@ -0,0 +1,158 @@
+// Copyright 2015 TIER IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <geometry/distance.hpp>
+#include <map>
+#include <memory>
+#include <string>
+#include <traffic_simulator/helper/helper.hpp>
+#include <traffic_simulator/traffic/traffic_source.hpp>
+#include <vector>
+
+/// @note Entities which never move, and the time of a simulation running at 20 frames per second.
+struct World
+{
+  std::map<std::string, geometry_msgs::msg::Pose> entities;
+
+  double current_time = 0.0;
+
+  auto makeTrafficSource(
+    const traffic_simulator::traffic::TrafficSource::Configuration & configuration)
+  {
+    static const auto hdmap_utils = []() {
+      geographic_msgs::msg::GeoPoint origin;
+      origin.latitude = 35.61836750154;
+      origin.longitude = 139.78066608243;
+      return std::make_shared<hdmap_utils::HdMapUtils>(
+        ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm",
+        origin);
+    }();
+    return traffic_simulator::traffic::TrafficSource(
+      "source",
+      {traffic_simulator::CanonicalizedLaneletPose(
+         traffic_simulator::helper::constructLaneletPose(34513, 0.0, 0.0), hdmap_utils),
+       traffic_simulator::CanonicalizedLaneletPose(
+         traffic_simulator::helper::constructLaneletPose(34513, 50.0, 0.0), hdmap_utils)},
+      configuration,
+      [this]() {
+        std::vector<std::string> names;
+        for (const auto & [name, pose] : entities) {
+          names.push_back(name);
+        }
+        return names;
+      },
+      [this](const std::string & name) { return entities.at(name); },
+      [this](const std::string & name, const traffic_simulator::CanonicalizedLaneletPose & pose) {
+        entities.emplace(name, static_cast<geometry_msgs::msg::Pose>(pose));
+      },
+      [this]() { return current_time; });
+  }
+
+  auto run(traffic_simulator::traffic::TrafficSource & source, double duration)
+  {
+    for (const auto end = current_time + duration; current_time < end; current_time += 0.05) {
+      source.execute();
+      // NOTE: Remove the spawned entities so that spawn poses are always clear.
+      entities.clear();
+    }
+  }
+};
+
+TEST(TrafficSource, FixedRate)
+{
+  World world;
+  traffic_simulator::traffic::TrafficSource::Configuration configuration;
+  configuration.rate = 20.0;
+  configuration.arrival = traffic_simulator::traffic::TrafficSource::Arrival::FIXED_RATE;
+  auto source = world.makeTrafficSource(configuration);
+  world.run(source, 10.0);
+  EXPECT_NEAR(source.getNumberOfSpawnedEntities(), 200, 1);
+}
+
+TEST(TrafficSource, PoissonIsReproducible)
+{
+  traffic_simulator::traffic::TrafficSource::Configuration configuration;
+  configuration.rate = 20.0;
+  configuration.seed = 42;
+  World world0, world1;
+  auto source0 = world0.makeTrafficSource(configuration);
+  auto source1 = world1.makeTrafficSource(configuration);
+  world0.run(source0, 100.0);
+  world1.run(source1, 100.0);
+  EXPECT_EQ(source0.getNumberOfSpawnedEntities(), source1.getNumberOfSpawnedEntities());
+  EXPECT_NEAR(source0.getNumberOfSpawnedEntities(), 2000, 200);
+}
+
+TEST(TrafficSource, Clearance)
+{
+  World world;
+  traffic_simulator::traffic::TrafficSource::Configuration configuration;
+  configuration.rate = 20.0;
+  configuration.clearance = 10.0;
+  auto source = world.makeTrafficSource(configuration);
+  for (; world.current_time < 10.0; world.current_time += 0.05) {
+    source.execute();
+  }
+  EXPECT_EQ(world.entities.size(), 2U);
+  for (const auto & [name0, pose0] : world.entities) {
+    for (const auto & [name1, pose1] : world.entities) {
+      if (name0 != name1) {
+        EXPECT_GE(math::geometry::getDistance(pose0, pose1), configuration.clearance);
+      }
+    }
+  }
+}
+
+TEST(TrafficSource, DensityCap)
+{
+  World world;
+  traffic_simulator::traffic::TrafficSource::Configuration configuration;
+  configuration.rate = 20.0;
+  configuration.clearance = 0.0;
+  configuration.maximum_number_of_entities_in_region = 5;
+  auto source = world.makeTrafficSource(configuration);
+  for (; world.current_time < 10.0; world.current_time += 0.05) {
+    source.execute();
+  }
+  EXPECT_EQ(world.entities.size(), 5U);
+}
+
+/// @note Names of the existing entities are skipped, since spawning an entity twice throws.
+TEST(TrafficSource, ExistingNameIsSkipped)
+{
+  World world;
+  traffic_simulator::traffic::TrafficSource::Configuration configuration;
+  configuration.rate = 20.0;
+  configuration.arrival = traffic_simulator::traffic::TrafficSource::Arrival::FIXED_RATE;
+  auto source = world.makeTrafficSource(configuration);
+  geometry_msgs::msg::Pose far_pose;
+  far_pose.position.x = 1.0e4;
+  world.entities.emplace("source_0", far_pose);
+  world.entities.emplace("source_1", far_pose);
+  for (; world.current_time < 0.075; world.current_time += 0.05) {
+    source.execute();
+  }
+  EXPECT_EQ(source.getNumberOfSpawnedEntities(), 1U);
+  EXPECT_EQ(world.entities.size(), 3U);
+  EXPECT_EQ(world.entities.count("source_2"), 1U);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -72,6 +72,7 @@ def launch_setup(context, *args, **kwargs):
     launch_simple_sensor_simulator  = LaunchConfiguration("launch_simple_sensor_simulator", default=True)
     output_directory                = LaunchConfiguration("output_directory",               default=Path("/tmp"))
     port                            = LaunchConfiguration("port",                           default=8080)
+    publish_decimation              = LaunchConfiguration("publish_decimation",             default=1)
     record                          = LaunchConfiguration("record",                         default=True)
     rviz_config                     = LaunchConfiguration("rviz_config",                    default="")
     scenario                        = LaunchConfiguration("scenario",                       default=Path("/dev/null"))
@@ -92,6 +93,7 @@ def launch_setup(context, *args, **kwargs):
     print(f"launch_rviz             := {launch_rviz.perform(context)}")
     print(f"output_directory        := {output_directory.perform(context)}")
     print(f"port                    := {port.perform(context)}")
+    print(f"publish_decimation      := {publish_decimation.perform(context)}")
     print(f"record                  := {record.perform(context)}")
     print(f"rviz_config             := {rviz_config.perform(context)}")
     print(f"scenario                := {scenario.perform(context)}")
@@ -108,6 +110,7 @@ def launch_setup(context, *args, **kwargs):
             {"initialize_duration": initialize_duration},
             {"launch_autoware": launch_autoware},
             {"port": port},
+            {"publish_decimation": publish_decimation},
             {"record": record},
             {"rviz_config": rviz_config},
             {"sensor_model": sensor_model},
@@ -140,6 +143,7 @@ def launch_setup(context, *args, **kwargs):
         DeclareLaunchArgument("launch_autoware",         default_value=launch_autoware        ),
         DeclareLaunchArgument("launch_rviz",             default_value=launch_rviz            ),
         DeclareLaunchArgument("output_directory",        default_value=output_directory       ),
+        DeclareLaunchArgument("publish_decimation",      default_value=publish_decimation     ),
         DeclareLaunchArgument("rviz_config",             default_value=rviz_config            ),
         DeclareLaunchArgument("scenario",                default_value=scenario               ),
         DeclareLaunchArgument("sensor_model",            default_value=sensor_model           ),